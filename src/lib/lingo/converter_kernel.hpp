@@ -0,0 +1,55 @@
+#ifndef H_LINGO_CONVERTER_KERNEL
+#define H_LINGO_CONVERTER_KERNEL
+
+#include <lingo/conversion_result.hpp>
+#include <lingo/platform/constexpr.hpp>
+
+#include <lingo/utility/span.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace lingo
+{
+	// Customization point for string_converter.
+	// Specialize this template to provide an optimized conversion routine for a specific combination of encodings and pages.
+	// A specialization must provide the following function:
+	//
+	// static conversion_result convert(
+	//     utility::span<const typename SourceEncoding::unit_type> source,
+	//     utility::span<typename DestinationEncoding::unit_type> destination,
+	//     bool final);
+	//
+	// The kernel converts as many units as it can, and stops when it reaches the end of either buffer or when it encounters
+	// input that it does not want to handle itself. string_converter then converts a single point with the generic
+	// implementation (including error handling) and calls the kernel again for the rest of the buffer.
+	// A kernel must never stop in the middle of a code point.
+	template <typename SourceEncoding, typename SourcePage, typename DestinationEncoding, typename DestinationPage, typename Enable = void>
+	struct converter_kernel
+	{
+	};
+
+	template <typename SourceEncoding, typename SourcePage, typename DestinationEncoding, typename DestinationPage, typename Enable = void>
+	struct has_converter_kernel : std::false_type
+	{
+	};
+
+	template <typename SourceEncoding, typename SourcePage, typename DestinationEncoding, typename DestinationPage>
+	struct has_converter_kernel<SourceEncoding, SourcePage, DestinationEncoding, DestinationPage,
+		typename std::enable_if<
+			std::is_same<
+				decltype(converter_kernel<SourceEncoding, SourcePage, DestinationEncoding, DestinationPage>::convert(
+					std::declval<utility::span<const typename SourceEncoding::unit_type>>(),
+					std::declval<utility::span<typename DestinationEncoding::unit_type>>(),
+					std::declval<bool>())),
+				conversion_result>::value>::type> : std::true_type
+	{
+	};
+
+	#ifdef __cpp_variable_templates
+	template <typename SourceEncoding, typename SourcePage, typename DestinationEncoding, typename DestinationPage>
+	LINGO_CONSTEXPR14 const bool has_converter_kernel_v = has_converter_kernel<SourceEncoding, SourcePage, DestinationEncoding, DestinationPage>::value;
+	#endif
+}
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef H_LINGO_ENCODING_ASCII_UNITS
+#define H_LINGO_ENCODING_ASCII_UNITS
+
+#include <lingo/encoding/endian.hpp>
+#include <lingo/encoding/join.hpp>
+#include <lingo/encoding/none.hpp>
+#include <lingo/encoding/utf8.hpp>
+#include <lingo/encoding/utf16.hpp>
+#include <lingo/encoding/utf32.hpp>
+
+#include <type_traits>
+
+namespace lingo
+{
+	namespace encoding
+	{
+		// Detects if every unit below 0x80 is a complete point with the same value as the unit,
+		// and if such a unit never appears as part of any other point
+		// Strings in these encodings can be searched for ASCII points by looking at the units alone
+		template <typename Encoding, typename Enable = void>
+		struct has_ascii_units : std::false_type
+		{
+		};
+
+		template <typename Unit, typename Point>
+		struct has_ascii_units<utf8<Unit, Point>> : std::true_type
+		{
+		};
+
+		template <typename Unit, typename Point>
+		struct has_ascii_units<utf16<Unit, Point>> : std::true_type
+		{
+		};
+
+		template <typename Unit, typename Point>
+		struct has_ascii_units<utf32<Unit, Point>> : std::true_type
+		{
+		};
+
+		template <typename Unit, typename Point>
+		struct has_ascii_units<none<Unit, Point>> : std::true_type
+		{
+		};
+
+		// Swapping the bytes of a single byte unit does nothing
+		template <typename Unit, typename Encoding>
+		struct has_ascii_units<join<swap_endian<Unit>, Encoding>, typename std::enable_if<sizeof(Unit) == 1>::type> : has_ascii_units<Encoding>
+		{
+		};
+	}
+}
+
+#endif
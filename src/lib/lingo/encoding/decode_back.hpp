@@ -0,0 +1,36 @@
+#ifndef H_LINGO_ENCODING_DECODE_BACK
+#define H_LINGO_ENCODING_DECODE_BACK
+
+#include <type_traits>
+#include <utility>
+
+namespace lingo
+{
+	namespace encoding
+	{
+		// Detects if an encoding can decode the last point of a buffer
+		// Such an encoding provides the following function:
+		//
+		// static decode_result_type decode_one_back(decode_source_type source, decode_destination_type destination);
+		//
+		// On success, the source of the result is the part of the source that comes before the decoded point.
+		// This is only possible for encodings that can find the start of a point by looking at the units before the end of the buffer.
+		template <typename Encoding, typename Enable = void>
+		struct has_decode_back : std::false_type
+		{
+		};
+
+		template <typename Encoding>
+		struct has_decode_back<Encoding,
+			typename std::enable_if<
+				std::is_same<
+					decltype(Encoding::decode_one_back(
+						std::declval<typename Encoding::decode_source_type>(),
+						std::declval<typename Encoding::decode_destination_type>())),
+					typename Encoding::decode_result_type>::value>::type> : std::true_type
+		{
+		};
+	}
+}
+
+#endif
@@ -4,8 +4,10 @@
 #include <lingo/platform/constexpr.hpp>
 #include <lingo/platform/warnings.hpp>
 
+#include <lingo/encoding/decode_back.hpp>
 #include <lingo/encoding/result.hpp>
 
+#include <cassert>
 #include <climits>
 #include <exception>
 #include <type_traits>
@@ -119,6 +121,72 @@ namespace lingo
 				assert(false);
 				std::terminate();
 			}
+
+			// Only available when all joined encodings can decode backwards. The function of the last encoding is hidden otherwise
+			template <typename _ = int, typename std::enable_if<has_decode_back<first_encoding>::value && has_decode_back<base_encoding>::value, _>::type = 0>
+			static LINGO_CONSTEXPR14 decode_result_type decode_one_back(decode_source_type source, decode_destination_type destination) noexcept
+			{
+				// Base units are decoded from the back of the source, and stored at the back of the buffer
+				// For every base unit we remember the part of the source that comes before it
+				typename base_encoding::unit_type first_destination_buffer[base_encoding::max_units]{};
+				decode_source_type first_sources[base_encoding::max_units]{};
+				auto first_source = source;
+				for (size_type i = 0; i < base_encoding::max_units; ++i)
+				{
+					const size_type index = base_encoding::max_units - 1 - i;
+
+					// Decode from first encoding
+					const auto first_result = first_encoding::decode_one_back(first_source,
+						utility::span<typename base_encoding::unit_type>(first_destination_buffer + index, 1));
+					if (first_result.error != lingo::error::error_code::success)
+					{
+						return { source, destination, first_result.error };
+					}
+
+					first_source = first_result.source;
+					first_sources[index] = first_source;
+
+					// Try to decode to base encoding
+					const auto base_result = base_encoding::decode_one_back(
+						utility::span<const typename base_encoding::unit_type>(first_destination_buffer + index, i + 1),
+						destination);
+					if (base_result.error != lingo::error::error_code::success)
+					{
+						if (base_result.error == lingo::error::error_code::source_buffer_too_small)
+						{
+							continue;
+						}
+						else
+						{
+							return { source, destination, base_result.error };
+						}
+					}
+
+					// Return the source that comes before the first base unit of the decoded point
+					return { first_sources[index + base_result.source.size()], base_result.destination, lingo::error::error_code::success };
+				}
+				// Should never be able to reach this.
+				// Either the code point is decoded successfully or an error occurs within base_encoding::max_units cycles
+				assert(false);
+				std::terminate();
+			}
+
+			// The unchecked functions of the last encoding would otherwise be inherited, so the joined encodings always use the checked path
+			static LINGO_CONSTEXPR14 encode_result_type encode_one_unchecked(encode_source_type source, encode_destination_type destination) noexcept
+			{
+				encode_state_type state{};
+				const auto result = encode_one(source, destination, state, true);
+				assert(result.error == lingo::error::error_code::success);
+				return result;
+			}
+
+			static LINGO_CONSTEXPR14 decode_result_type decode_one_unchecked(decode_source_type source, decode_destination_type destination) noexcept
+			{
+				decode_state_type state{};
+				const auto result = decode_one(source, destination, state, true);
+				assert(result.error == lingo::error::error_code::success);
+				return result;
+			}
 		};
 
 		template <typename LastEncoding>
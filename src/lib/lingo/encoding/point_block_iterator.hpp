@@ -0,0 +1,231 @@
+#ifndef H_LINGO_ENCODING_POINT_BLOCK_ITERATOR
+#define H_LINGO_ENCODING_POINT_BLOCK_ITERATOR
+
+#include <lingo/platform/constexpr.hpp>
+#include <lingo/error/assume_valid.hpp>
+#include <lingo/error/handler_tag.hpp>
+#include <lingo/error/strict.hpp>
+
+#include <lingo/encoding/unchecked.hpp>
+
+#include <lingo/utility/compressed_pair.hpp>
+#include <lingo/utility/span.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace lingo
+{
+	template <typename Encoding, typename Page, typename Allocator, typename Layout>
+	class basic_string;
+
+	template <typename Encoding, typename Page>
+	class basic_string_view;
+
+	namespace encoding
+	{
+		// Iterates over the points of a string in blocks of up to BlockSize points
+		// Every step decodes a whole block into an internal buffer in a single tight loop, and dereferencing
+		// the iterator gives a span over the decoded points. Only the last block can be smaller than BlockSize.
+		// The span points into the iterator itself, so it is only valid until the iterator is incremented or destroyed.
+		// For the same reason the postfix increment does not return a copy of the previous iterator.
+		template <typename Encoding, typename ErrorHandler = error::strict<Encoding, void>, std::size_t BlockSize = 64>
+		class point_block_iterator
+		{
+			static_assert(BlockSize > 0, "BlockSize must be at least 1");
+
+			public:
+			using encoding_type = Encoding;
+			using error_handler_type = ErrorHandler;
+
+			using unit_type = typename encoding_type::unit_type;
+			using point_type = typename encoding_type::point_type;
+
+			using size_type = typename encoding_type::size_type;
+			using difference_type = typename encoding_type::difference_type;
+
+			using iterator_category = std::input_iterator_tag;
+			using value_type = utility::span<const point_type>;
+			using pointer = const value_type*;
+			using reference = value_type;
+
+			static LINGO_CONSTEXPR11 const size_type block_size = BlockSize;
+
+			// True if the error handler never throws, in which case the iterator never throws either
+			static LINGO_CONSTEXPR11 const bool is_nothrow = noexcept(error_handler_type::handle(
+				std::declval<const typename encoding_type::decode_result_type&>(),
+				std::declval<typename encoding_type::decode_source_type>(),
+				std::declval<typename encoding_type::decode_destination_type>()));
+
+			LINGO_CONSTEXPR14 point_block_iterator() noexcept:
+				_first(nullptr),
+				_current(nullptr),
+				_end(nullptr),
+				_points{},
+				_state{}
+			{
+			}
+
+			template <typename Page, typename Allocator, typename Layout>
+			point_block_iterator(const basic_string<encoding_type, Page, Allocator, Layout>& str) noexcept(is_nothrow):
+				_first(str.data()),
+				_current(str.data()),
+				_end(str.data() + str.size()),
+				_points{},
+				_state{}
+			{
+				parse_next();
+			}
+
+			template <typename Page>
+			LINGO_CONSTEXPR14 point_block_iterator(basic_string_view<encoding_type, Page> str) noexcept(is_nothrow):
+				_first(str.data()),
+				_current(str.data()),
+				_end(str.data() + str.size()),
+				_points{},
+				_state{}
+			{
+				parse_next();
+			}
+
+			// Pointer to the first unit of the current block
+			LINGO_CONSTEXPR14 const unit_type* read_ptr() const noexcept
+			{
+				return _first;
+			}
+
+			LINGO_CONSTEXPR14 value_type operator * () const noexcept
+			{
+				return value_type(_points, _state.first());
+			}
+
+			LINGO_CONSTEXPR14 point_block_iterator& operator ++() noexcept(is_nothrow)
+			{
+				parse_next();
+				return *this;
+			}
+
+			LINGO_CONSTEXPR14 void operator ++(int) noexcept(is_nothrow)
+			{
+				operator++();
+			}
+
+			LINGO_CONSTEXPR14 bool operator == (const point_block_iterator& right) const noexcept
+			{
+				return (_first == right._first) && (_end == right._end);
+			}
+
+			LINGO_CONSTEXPR14 bool operator != (const point_block_iterator& right) const noexcept
+			{
+				return !(*this == right);
+			}
+
+			private:
+			LINGO_CONSTEXPR14 void parse_next() noexcept(is_nothrow)
+			{
+				_first = _current;
+				size_type count = 0;
+
+				while (count < BlockSize && _current != _end)
+				{
+					const utility::span<const unit_type> source_span(_current, _end);
+					const utility::span<point_type> destination_span(_points + count, 1);
+
+					auto result = decode_one(source_span, destination_span, _state.second(), error::is_assume_valid<error_handler_type>());
+					if (result.error != error::error_code::success)
+					{
+						// Throwing error handlers never return from an error
+						result = error_handler_type::handle(result, source_span, destination_span);
+
+						// The error handler gave up, the current block will be the last one
+						if (result.error != error::error_code::success)
+						{
+							_end = _current;
+							break;
+						}
+					}
+
+					_current += source_span.diff(result.source).size();
+					assert(_current <= _end); // _current should never go beyond _end
+
+					// A point was produced
+					if (result.destination.size() != destination_span.size())
+					{
+						++count;
+					}
+				}
+
+				_state.first() = count;
+
+				// No points left, this is the end iterator now
+				if (count == 0)
+				{
+					_first = nullptr;
+					_current = nullptr;
+					_end = nullptr;
+				}
+			}
+
+			static LINGO_CONSTEXPR14 typename encoding_type::decode_result_type decode_one(
+				utility::span<const unit_type> source, utility::span<point_type> destination,
+				typename encoding_type::decode_state_type& state, std::false_type) noexcept
+			{
+				return encoding_type::decode_one(source, destination, state, true);
+			}
+
+			static LINGO_CONSTEXPR14 typename encoding_type::decode_result_type decode_one(
+				utility::span<const unit_type> source, utility::span<point_type> destination,
+				typename encoding_type::decode_state_type& state, std::true_type) noexcept
+			{
+				return unchecked<encoding_type>::decode_one(source, destination, state, true);
+			}
+
+			const unit_type* _first;
+			const unit_type* _current;
+			const unit_type* _end;
+			point_type _points[BlockSize];
+			utility::compressed_pair<size_type, typename encoding_type::decode_state_type> _state;
+		};
+
+		template <typename Encoding, typename ErrorHandler, std::size_t BlockSize>
+		LINGO_CONSTEXPR11 const typename point_block_iterator<Encoding, ErrorHandler, BlockSize>::size_type point_block_iterator<Encoding, ErrorHandler, BlockSize>::block_size;
+
+		template <typename Encoding, typename ErrorHandler, std::size_t BlockSize>
+		LINGO_CONSTEXPR11 const bool point_block_iterator<Encoding, ErrorHandler, BlockSize>::is_nothrow;
+
+		template <typename Encoding, typename ErrorHandler, std::size_t BlockSize>
+		LINGO_CONSTEXPR14 point_block_iterator<Encoding, ErrorHandler, BlockSize> begin(const point_block_iterator<Encoding, ErrorHandler, BlockSize>& it)
+		{
+			return it;
+		}
+
+		template <typename Encoding, typename ErrorHandler, std::size_t BlockSize>
+		LINGO_CONSTEXPR14 point_block_iterator<Encoding, ErrorHandler, BlockSize> end(const point_block_iterator<Encoding, ErrorHandler, BlockSize>&)
+		{
+			return {};
+		}
+
+		// Calls callback with a utility::span<const point_type> for every block of decoded points in the string
+		template <std::size_t BlockSize = 64, template <typename, typename> class ErrorHandler, typename Encoding, typename Page, typename Callback>
+		LINGO_CONSTEXPR14 void for_each_point_block(basic_string_view<Encoding, Page> str, error::handler_tag<ErrorHandler>, Callback&& callback)
+		{
+			using iterator_type = point_block_iterator<Encoding, ErrorHandler<Encoding, Page>, BlockSize>;
+
+			for (iterator_type it(str), last; it != last; ++it)
+			{
+				callback(*it);
+			}
+		}
+
+		template <std::size_t BlockSize = 64, typename Encoding, typename Page, typename Callback>
+		LINGO_CONSTEXPR14 void for_each_point_block(basic_string_view<Encoding, Page> str, Callback&& callback)
+		{
+			for_each_point_block<BlockSize>(str, error::handler_tag<error::strict>(), std::forward<Callback>(callback));
+		}
+	}
+}
+
+#endif
@@ -2,15 +2,22 @@
 #define H_LINGO_ENCODING_POINT_ITERATOR
 
 #include <lingo/platform/constexpr.hpp>
-#include <lingo/error/exception.hpp>
+#include <lingo/error/assume_valid.hpp>
+#include <lingo/error/strict.hpp>
+
+#include <lingo/encoding/decode_back.hpp>
+#include <lingo/encoding/unchecked.hpp>
 
 #include <lingo/utility/compressed_pair.hpp>
 
+#include <cassert>
 #include <iterator>
+#include <type_traits>
+#include <utility>
 
 namespace lingo
 {
-	template <typename Encoding, typename Page, typename Allocator>
+	template <typename Encoding, typename Page, typename Allocator, typename Layout>
 	class basic_string;
 
 	template <typename Encoding, typename Page>
@@ -18,11 +25,14 @@ namespace lingo
 
 	namespace encoding
 	{
-		template <typename Encoding>
+		// Iterates over the points of a string
+		// The iterator is bidirectional if the encoding can decode backwards, see has_decode_back
+		template <typename Encoding, typename ErrorHandler = error::strict<Encoding, void>>
 		class point_iterator
 		{
 			public:
 			using encoding_type = Encoding;
+			using error_handler_type = ErrorHandler;
 
 			using unit_type = typename encoding_type::unit_type;
 			using point_type = typename encoding_type::point_type;
@@ -30,14 +40,25 @@ namespace lingo
 			using size_type = typename encoding_type::size_type;
 			using difference_type = typename encoding_type::difference_type;
 
-			using iterator_catagory = std::input_iterator_tag;
+			static LINGO_CONSTEXPR11 const bool is_bidirectional = has_decode_back<encoding_type>::value;
+
+			using iterator_category = typename std::conditional<is_bidirectional, std::bidirectional_iterator_tag, std::input_iterator_tag>::type;
+			using iterator_catagory = iterator_category;
 			using value_type = point_type;
 			using pointer = value_type*;
 			using const_pointer = const value_type*;
-			using reference = value_type&;
-			using const_reference = const value_type&;
+			// Points are returned by value, so that dereferencing a temporary copy (like std::reverse_iterator does) is safe
+			using reference = value_type;
+			using const_reference = value_type;
+
+			// True if the error handler never throws, in which case the iterator never throws either
+			static LINGO_CONSTEXPR11 const bool is_nothrow = noexcept(error_handler_type::handle(
+				std::declval<const typename encoding_type::decode_result_type&>(),
+				std::declval<typename encoding_type::decode_source_type>(),
+				std::declval<typename encoding_type::decode_destination_type>()));
 
 			LINGO_CONSTEXPR14 point_iterator() noexcept:
+				_begin(nullptr),
 				_current(nullptr),
 				_end(nullptr),
 				_last(nullptr),
@@ -45,8 +66,9 @@ namespace lingo
 			{
 			}
 
-			template <typename Page, typename Allocator>
-			point_iterator(const basic_string<encoding_type, Page, Allocator>& str):
+			template <typename Page, typename Allocator, typename Layout>
+			point_iterator(const basic_string<encoding_type, Page, Allocator, Layout>& str) noexcept(is_nothrow):
+				_begin(str.data()),
 				_current(str.data()),
 				_end(str.data() + str.size()),
 				_last(str.data()),
@@ -56,7 +78,8 @@ namespace lingo
 			}
 
 			template <typename Page>
-			LINGO_CONSTEXPR14 point_iterator(basic_string_view<encoding_type, Page> str):
+			LINGO_CONSTEXPR14 point_iterator(basic_string_view<encoding_type, Page> str) noexcept(is_nothrow):
+				_begin(str.data()),
 				_current(str.data()),
 				_end(str.data() + str.size()),
 				_last(str.data()),
@@ -70,24 +93,42 @@ namespace lingo
 				return _last;
 			}
 
-			LINGO_CONSTEXPR14 const_reference operator * () const noexcept
+			LINGO_CONSTEXPR14 value_type operator * () const noexcept
 			{
 				return _state.first();
 			}
 
-			LINGO_CONSTEXPR14 point_iterator& operator ++()
+			LINGO_CONSTEXPR14 point_iterator& operator ++() noexcept(is_nothrow)
 			{
 				parse_next();
 				return *this;
 			}
 
-			LINGO_CONSTEXPR14 point_iterator operator ++(int)
+			LINGO_CONSTEXPR14 point_iterator operator ++(int) noexcept(is_nothrow)
 			{
 				point_iterator prev(*this);
 				operator++();
 				return prev;
 			}
 
+			// Moves to the previous point
+			// Decrementing the end iterator moves to the last point of the string, but only if it was created from that string
+			// If there is no point left before the current position, or the error handler gives up, the iterator becomes the end iterator
+			template <typename _ = int, typename std::enable_if<is_bidirectional, _>::type = 0>
+			LINGO_CONSTEXPR14 point_iterator& operator --() noexcept(is_nothrow)
+			{
+				parse_previous();
+				return *this;
+			}
+
+			template <typename _ = int, typename std::enable_if<is_bidirectional, _>::type = 0>
+			LINGO_CONSTEXPR14 point_iterator operator --(int) noexcept(is_nothrow)
+			{
+				point_iterator prev(*this);
+				operator--();
+				return prev;
+			}
+
 			LINGO_CONSTEXPR14 const_pointer operator -> () const noexcept
 			{
 				return &(_state.first());
@@ -95,7 +136,7 @@ namespace lingo
 
 			LINGO_CONSTEXPR14 bool operator == (const point_iterator& right) const noexcept
 			{
-				return (_current == right._current) && (_end == right._end);
+				return ((_last == right._last) && (_end == right._end)) || (at_end() && right.at_end());
 			}
 
 			LINGO_CONSTEXPR14 bool operator != (const point_iterator& right) const noexcept
@@ -104,48 +145,146 @@ namespace lingo
 			}
 
 			private:
-			LINGO_CONSTEXPR14 void parse_next()
+			LINGO_CONSTEXPR14 bool at_end() const noexcept
+			{
+				return _last == _end;
+			}
+
+			LINGO_CONSTEXPR14 void parse_next() noexcept(is_nothrow)
 			{
-				// End of string reached
-				if (_current == _end)
+				// Decode the next point, skipping over any units the error handler drops
+				while (_current != _end)
 				{
-					_current = nullptr;
-					_end = nullptr;
-					_last = nullptr;
-					return;
+					_last = _current;
+					const utility::span<const unit_type> source_span(_current, _end);
+					const utility::span<point_type> destination_span(&(_state.first()), 1);
+
+					auto result = decode_one(source_span, destination_span, _state.second(), error::is_assume_valid<error_handler_type>());
+					if (result.error != error::error_code::success)
+					{
+						// Throwing error handlers never return from an error
+						result = error_handler_type::handle(result, source_span, destination_span);
+
+						// The error handler gave up, end the iteration here
+						if (result.error != error::error_code::success)
+						{
+							_end = _current;
+							break;
+						}
+					}
+
+					// Move the current pointer
+					_current += source_span.diff(result.source).size();
+					assert(_current <= _end); // _current should never go beyond _end
+
+					// A point was produced
+					if (result.destination.size() != destination_span.size())
+					{
+						return;
+					}
 				}
 
-				const utility::span<const unit_type> source_span(_current, _end);
-				const utility::span<point_type> destination_span(&(_state.first()), 1);
+				// End of string reached, only dropped units were left, or the error handler stopped the iteration
+				_last = _end;
+				_current = _end;
+			}
+
+			LINGO_CONSTEXPR14 void parse_previous() noexcept(is_nothrow)
+			{
+				assert(_last != nullptr); // Default constructed iterators can not be decremented
 
-				// Decode the next points
-				auto result = encoding_type::decode_one(source_span, destination_span, _state.second(), true);
-				// TODO: configurable error handling
-				if (result.error != error::error_code::success)
+				// Decode the previous point, skipping over any units the error handler drops
+				const unit_type* current = _last;
+				while (current != _begin)
 				{
-					throw error::exception(result.error);
+					const utility::span<const unit_type> source_span(_begin, current);
+					const utility::span<point_type> destination_span(&(_state.first()), 1);
+
+					auto result = decode_one_back(source_span, destination_span, error::is_assume_valid<error_handler_type>());
+					if (result.error != error::error_code::success)
+					{
+						// Error handlers work on the front of the source, so they only get to see the last unit
+						const utility::span<const unit_type> unit_span(current - 1, 1);
+						result = error_handler_type::handle({ unit_span, destination_span, result.error }, unit_span, destination_span);
+
+						// The error handler gave up
+						if (result.error != error::error_code::success)
+						{
+							break;
+						}
+
+						current -= 1 - result.source.size();
+					}
+					else
+					{
+						current = result.source.data() + result.source.size();
+					}
+
+					// A point was produced
+					if (result.destination.size() != destination_span.size())
+					{
+						_current = _last;
+						_last = current;
+						return;
+					}
 				}
 
-				// Move the current pointer
-				_last = _current;
-				_current += source_span.diff(result.source).size();
-				assert(_current <= _end); // _current should never go beyond _end
+				// Nothing left before the current position
+				_begin = nullptr;
+				_current = nullptr;
+				_end = nullptr;
+				_last = nullptr;
+			}
+
+			static LINGO_CONSTEXPR14 typename encoding_type::decode_result_type decode_one(
+				utility::span<const unit_type> source, utility::span<point_type> destination,
+				typename encoding_type::decode_state_type& state, std::false_type) noexcept
+			{
+				return encoding_type::decode_one(source, destination, state, true);
+			}
+
+			static LINGO_CONSTEXPR14 typename encoding_type::decode_result_type decode_one(
+				utility::span<const unit_type> source, utility::span<point_type> destination,
+				typename encoding_type::decode_state_type& state, std::true_type) noexcept
+			{
+				return unchecked<encoding_type>::decode_one(source, destination, state, true);
+			}
+
+			static LINGO_CONSTEXPR14 typename encoding_type::decode_result_type decode_one_back(
+				utility::span<const unit_type> source, utility::span<point_type> destination, std::false_type) noexcept
+			{
+				return encoding_type::decode_one_back(source, destination);
+			}
+
+			static LINGO_CONSTEXPR14 typename encoding_type::decode_result_type decode_one_back(
+				utility::span<const unit_type> source, utility::span<point_type> destination, std::true_type) noexcept
+			{
+				const auto result = encoding_type::decode_one_back(source, destination);
+				assert(result.error == error::error_code::success);
+				return result;
 			}
 
+			const unit_type* _begin;
 			const unit_type* _current;
 			const unit_type* _end;
 			const unit_type* _last;
 			utility::compressed_pair<point_type, typename encoding_type::decode_state_type> _state;
 		};
 
-		template <typename Encoding>
-		LINGO_CONSTEXPR14 point_iterator<Encoding> begin(const point_iterator<Encoding>& it)
+		template <typename Encoding, typename ErrorHandler>
+		LINGO_CONSTEXPR11 const bool point_iterator<Encoding, ErrorHandler>::is_bidirectional;
+
+		template <typename Encoding, typename ErrorHandler>
+		LINGO_CONSTEXPR11 const bool point_iterator<Encoding, ErrorHandler>::is_nothrow;
+
+		template <typename Encoding, typename ErrorHandler>
+		LINGO_CONSTEXPR14 point_iterator<Encoding, ErrorHandler> begin(const point_iterator<Encoding, ErrorHandler>& it)
 		{
 			return it;
 		}
 
-		template <typename Encoding>
-		LINGO_CONSTEXPR14 point_iterator<Encoding> end(const point_iterator<Encoding>&)
+		template <typename Encoding, typename ErrorHandler>
+		LINGO_CONSTEXPR14 point_iterator<Encoding, ErrorHandler> end(const point_iterator<Encoding, ErrorHandler>&)
 		{
 			return {};
 		}
@@ -0,0 +1,97 @@
+#ifndef H_LINGO_ENCODING_UNCHECKED
+#define H_LINGO_ENCODING_UNCHECKED
+
+#include <lingo/platform/constexpr.hpp>
+
+#include <lingo/error/error_code.hpp>
+
+#include <lingo/utility/type_traits.hpp>
+
+#include <cassert>
+#include <type_traits>
+#include <utility>
+
+namespace lingo
+{
+	namespace encoding
+	{
+		template <typename Encoding, typename Enable = void>
+		struct has_unchecked_decode : std::false_type
+		{
+		};
+
+		template <typename Encoding>
+		struct has_unchecked_decode<Encoding, utility::void_t<decltype(Encoding::decode_one_unchecked(
+			std::declval<typename Encoding::decode_source_type>(),
+			std::declval<typename Encoding::decode_destination_type>()))>> : std::true_type
+		{
+		};
+
+		template <typename Encoding, typename Enable = void>
+		struct has_unchecked_encode : std::false_type
+		{
+		};
+
+		template <typename Encoding>
+		struct has_unchecked_encode<Encoding, utility::void_t<decltype(Encoding::encode_one_unchecked(
+			std::declval<typename Encoding::encode_source_type>(),
+			std::declval<typename Encoding::encode_destination_type>()))>> : std::true_type
+		{
+		};
+
+		// Encodes and decodes input that is known to be valid
+		// Uses the encode_one_unchecked and decode_one_unchecked functions of the encoding when they exist,
+		// and falls back to the regular encode_one and decode_one functions otherwise
+		template <typename Encoding>
+		struct unchecked
+		{
+			using encoding_type = Encoding;
+
+			using encode_result_type = typename encoding_type::encode_result_type;
+			using decode_result_type = typename encoding_type::decode_result_type;
+			using encode_source_type = typename encoding_type::encode_source_type;
+			using decode_source_type = typename encoding_type::decode_source_type;
+			using encode_destination_type = typename encoding_type::encode_destination_type;
+			using decode_destination_type = typename encoding_type::decode_destination_type;
+			using encode_state_type = typename encoding_type::encode_state_type;
+			using decode_state_type = typename encoding_type::decode_state_type;
+
+			static LINGO_CONSTEXPR14 encode_result_type encode_one(encode_source_type source, encode_destination_type destination, encode_state_type& state, bool final) noexcept
+			{
+				return encode_one(source, destination, state, final, has_unchecked_encode<encoding_type>());
+			}
+
+			static LINGO_CONSTEXPR14 decode_result_type decode_one(decode_source_type source, decode_destination_type destination, decode_state_type& state, bool final) noexcept
+			{
+				return decode_one(source, destination, state, final, has_unchecked_decode<encoding_type>());
+			}
+
+			private:
+			static LINGO_CONSTEXPR14 encode_result_type encode_one(encode_source_type source, encode_destination_type destination, encode_state_type&, bool, std::true_type) noexcept
+			{
+				return encoding_type::encode_one_unchecked(source, destination);
+			}
+
+			static LINGO_CONSTEXPR14 encode_result_type encode_one(encode_source_type source, encode_destination_type destination, encode_state_type& state, bool final, std::false_type) noexcept
+			{
+				const auto result = encoding_type::encode_one(source, destination, state, final);
+				assert(result.error == error::error_code::success);
+				return result;
+			}
+
+			static LINGO_CONSTEXPR14 decode_result_type decode_one(decode_source_type source, decode_destination_type destination, decode_state_type&, bool, std::true_type) noexcept
+			{
+				return encoding_type::decode_one_unchecked(source, destination);
+			}
+
+			static LINGO_CONSTEXPR14 decode_result_type decode_one(decode_source_type source, decode_destination_type destination, decode_state_type& state, bool final, std::false_type) noexcept
+			{
+				const auto result = encoding_type::decode_one(source, destination, state, final);
+				assert(result.error == error::error_code::success);
+				return result;
+			}
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef H_LINGO_ENCODING_UNIT_ORDER
+#define H_LINGO_ENCODING_UNIT_ORDER
+
+#include <lingo/platform/constexpr.hpp>
+#include <lingo/platform/endian.hpp>
+
+#include <lingo/encoding/endian.hpp>
+#include <lingo/encoding/join.hpp>
+#include <lingo/encoding/none.hpp>
+#include <lingo/encoding/utf8.hpp>
+#include <lingo/encoding/utf16.hpp>
+#include <lingo/encoding/utf32.hpp>
+
+#include <lingo/utility/span.hpp>
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace lingo
+{
+	namespace encoding
+	{
+		// Describes how the units of an encoding relate to the order of its points
+		// A specialization provides the following function:
+		//
+		// static key_type key(unit_type unit);
+		//
+		// Comparing two valid strings unit by unit through their keys must give the same result as comparing their points,
+		// and two units must have the same key only if they are equal.
+		// This lets strings be compared by looking for the first unit that differs, and only comparing the keys of that unit.
+		template <typename Encoding, typename Enable = void>
+		struct unit_order
+		{
+		};
+
+		template <typename Encoding, typename Enable = void>
+		struct has_unit_order : std::false_type
+		{
+		};
+
+		template <typename Encoding>
+		struct has_unit_order<Encoding, typename std::enable_if<
+			!std::is_void<decltype(unit_order<Encoding>::key(std::declval<typename Encoding::unit_type>()))>::value>::type> : std::true_type
+		{
+		};
+
+		// The units of utf8 are ordered the same as the points when they are treated as unsigned
+		template <typename Unit, typename Point>
+		struct unit_order<utf8<Unit, Point>>
+		{
+			static LINGO_CONSTEXPR11 typename std::make_unsigned<Unit>::type key(Unit unit) noexcept
+			{
+				return static_cast<typename std::make_unsigned<Unit>::type>(unit);
+			}
+		};
+
+		// Surrogates sort below the units in the range 0xE000 to 0xFFFF, but the points they encode sort above them
+		// Moving the surrogates to the top of the range gives the same order as the points
+		template <typename Unit, typename Point>
+		struct unit_order<utf16<Unit, Point>>
+		{
+			static LINGO_CONSTEXPR11 std::uint_least32_t key(Unit unit) noexcept
+			{
+				return
+					static_cast<std::uint_least32_t>(unit) >= 0xE000 ? static_cast<std::uint_least32_t>(unit) - 0x800 :
+					static_cast<std::uint_least32_t>(unit) >= 0xD800 ? static_cast<std::uint_least32_t>(unit) + 0x2000 :
+					static_cast<std::uint_least32_t>(unit);
+			}
+		};
+
+		// Encodings that store every point in a single unit are ordered by the points themselves
+		template <typename Unit, typename Point>
+		struct unit_order<utf32<Unit, Point>>
+		{
+			static LINGO_CONSTEXPR14 Point key(Unit unit) noexcept
+			{
+				Point point{};
+				utf32<Unit, Point>::decode_one_unchecked(utility::span<const Unit>(&unit, 1), utility::span<Point>(&point, 1));
+				return point;
+			}
+		};
+
+		template <typename Unit, typename Point>
+		struct unit_order<none<Unit, Point>>
+		{
+			static LINGO_CONSTEXPR14 Point key(Unit unit) noexcept
+			{
+				Point point{};
+				none<Unit, Point>::decode_one_unchecked(utility::span<const Unit>(&unit, 1), utility::span<Point>(&point, 1));
+				return point;
+			}
+		};
+
+		// Byte swapped encodings are ordered the same as the original encoding after swapping the units back
+		template <typename Unit, typename Encoding>
+		struct unit_order<join<swap_endian<Unit>, Encoding>, typename std::enable_if<has_unit_order<Encoding>::value>::type>
+		{
+			static LINGO_CONSTEXPR14 auto key(Unit unit) noexcept -> decltype(unit_order<Encoding>::key(unit))
+			{
+				return unit_order<Encoding>::key(platform::swap_endian(unit));
+			}
+		};
+	}
+}
+
+#endif
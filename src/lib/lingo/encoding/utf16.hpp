@@ -230,6 +230,95 @@ namespace lingo
 					return { source.subspan(2), destination.subspan(1), error::error_code::success };
 				}
 			}
+
+			static LINGO_CONSTEXPR14 decode_result_type decode_one_back(decode_source_type source, decode_destination_type destination) noexcept
+			{
+				// Check if there is at least one unit
+				if (source.size() < 1)
+				{
+					return { source, destination, error::error_code::source_buffer_too_small };
+				}
+
+				// A low surrogate must be preceded by a high surrogate
+				size_type first_index = source.size() - 1;
+				if ((bit_converter_type::to_unit_bits(source[first_index]) & 0xFC00) == 0xDC00)
+				{
+					if (first_index == 0)
+					{
+						return { source, destination, error::error_code::source_buffer_too_small };
+					}
+
+					--first_index;
+				}
+
+				// The first unit must describe exactly the units that follow it
+				if (unit_size(source[first_index]) != source.size() - first_index)
+				{
+					return { source, destination, error::error_code::invalid_unit };
+				}
+
+				// Decode the code point
+				const auto result = decode_one(source.subspan(first_index), destination);
+				if (result.error != error::error_code::success)
+				{
+					return { source, destination, result.error };
+				}
+
+				return { source.subspan(0, first_index), result.destination, error::error_code::success };
+			}
+
+			// Decodes a single point without any validation
+			// The source must start with a complete and valid code point, and the destination must have room for at least 1 point
+			static LINGO_CONSTEXPR14 decode_result_type decode_one_unchecked(decode_source_type source, decode_destination_type destination) noexcept
+			{
+				assert(source.size() >= 1);
+				assert(destination.size() >= 1);
+
+				const unit_bits_type high_unit_bits = bit_converter_type::to_unit_bits(source[0]);
+
+				// Decode single unit
+				if ((high_unit_bits & 0xF800) != 0xD800)
+				{
+					destination[0] = bit_converter_type::from_point_bits(static_cast<point_bits_type>(high_unit_bits));
+					return { source.subspan(1), destination.subspan(1), error::error_code::success };
+				}
+
+				// Decode surrogate pair
+				assert(source.size() >= 2);
+				const unit_bits_type low_unit_bits = bit_converter_type::to_unit_bits(source[1]);
+
+				point_bits_type point_bits = static_cast<point_bits_type>(high_unit_bits - 0xD800);
+				point_bits <<= 10;
+				point_bits |= static_cast<point_bits_type>(low_unit_bits - 0xDC00);
+				point_bits += 0x10000;
+
+				destination[0] = bit_converter_type::from_point_bits(point_bits);
+				return { source.subspan(2), destination.subspan(1), error::error_code::success };
+			}
+
+			// Encodes a single point without any validation
+			// The source must start with a valid code point, and the destination must have room for at least max_units units
+			static LINGO_CONSTEXPR14 encode_result_type encode_one_unchecked(encode_source_type source, encode_destination_type destination) noexcept
+			{
+				assert(source.size() >= 1);
+
+				point_bits_type point_bits = bit_converter_type::to_point_bits(source[0]);
+
+				// Encode single unit
+				if (point_bits <= 0xFFFF)
+				{
+					assert(destination.size() >= 1);
+					destination[0] = bit_converter_type::from_unit_bits(static_cast<unit_bits_type>(point_bits));
+					return { source.subspan(1), destination.subspan(1), error::error_code::success };
+				}
+
+				// Encode surrogate pair
+				assert(destination.size() >= 2);
+				point_bits -= 0x10000;
+				destination[0] = bit_converter_type::from_unit_bits(static_cast<unit_bits_type>((point_bits >> 10) + 0xD800));
+				destination[1] = bit_converter_type::from_unit_bits(static_cast<unit_bits_type>((point_bits & 0x3FF) + 0xDC00));
+				return { source.subspan(1), destination.subspan(2), error::error_code::success };
+			}
 		};
 
 		template <typename Unit, typename Point>
@@ -6,6 +6,7 @@
 #include <lingo/encoding/result.hpp>
 #include <lingo/encoding/internal/bit_converter.hpp>
 
+#include <cassert>
 #include <climits>
 #include <cstddef>
 
@@ -129,6 +130,46 @@ namespace lingo
 				destination[0] = bit_converter_type::from_point_bits(point_bits);
 				return { source.subspan(1), destination.subspan(1), error::error_code::success };
 			}
+
+			static LINGO_CONSTEXPR14 decode_result_type decode_one_back(decode_source_type source, decode_destination_type destination) noexcept
+			{
+				// Every point is a single unit, so the last unit is the last point
+				if (source.size() < 1)
+				{
+					return { source, destination, error::error_code::source_buffer_too_small };
+				}
+
+				const size_type first_index = source.size() - 1;
+				const auto result = decode_one(source.subspan(first_index), destination);
+				if (result.error != error::error_code::success)
+				{
+					return { source, destination, result.error };
+				}
+
+				return { source.subspan(0, first_index), result.destination, error::error_code::success };
+			}
+
+			// Decodes a single point without any validation
+			// The source must start with a valid code point, and the destination must have room for at least 1 point
+			static LINGO_CONSTEXPR14 decode_result_type decode_one_unchecked(decode_source_type source, decode_destination_type destination) noexcept
+			{
+				assert(source.size() >= 1);
+				assert(destination.size() >= 1);
+
+				destination[0] = bit_converter_type::from_point_bits(static_cast<point_bits_type>(bit_converter_type::to_unit_bits(source[0])));
+				return { source.subspan(1), destination.subspan(1), error::error_code::success };
+			}
+
+			// Encodes a single point without any validation
+			// The source must start with a valid code point, and the destination must have room for at least 1 unit
+			static LINGO_CONSTEXPR14 encode_result_type encode_one_unchecked(encode_source_type source, encode_destination_type destination) noexcept
+			{
+				assert(source.size() >= 1);
+				assert(destination.size() >= 1);
+
+				destination[0] = bit_converter_type::from_unit_bits(static_cast<unit_bits_type>(bit_converter_type::to_point_bits(source[0])));
+				return { source.subspan(1), destination.subspan(1), error::error_code::success };
+			}
 		};
 	}
 }
@@ -257,6 +257,102 @@ namespace lingo
 				// Return the result
 				return { source.subspan(required_size), destination.subspan(1), error::error_code::success };
 			}
+
+			static LINGO_CONSTEXPR14 decode_result_type decode_one_back(decode_source_type source, decode_destination_type destination) noexcept
+			{
+				// Check if there is at least one unit
+				if (source.size() == 0)
+				{
+					return { source, destination, error::error_code::source_buffer_too_small };
+				}
+
+				// Find the first unit of the last code point by skipping over the continuation units
+				size_type first_index = source.size() - 1;
+				while ((bit_converter_type::to_unit_bits(source[first_index]) & continuation_unit_prefix_mask) == continuation_unit_prefix_marker)
+				{
+					// Too many continuation units in a row
+					if (source.size() - first_index >= max_units)
+					{
+						return { source, destination, error::error_code::invalid_unit };
+					}
+
+					// The first unit might be before the start of the buffer
+					if (first_index == 0)
+					{
+						return { source, destination, error::error_code::source_buffer_too_small };
+					}
+
+					--first_index;
+				}
+
+				// The first unit must describe exactly the units that follow it
+				if (unit_size(source[first_index]) != source.size() - first_index)
+				{
+					return { source, destination, error::error_code::invalid_unit };
+				}
+
+				// Decode the code point
+				const auto result = decode_one(source.subspan(first_index), destination);
+				if (result.error != error::error_code::success)
+				{
+					return { source, destination, result.error };
+				}
+
+				return { source.subspan(0, first_index), result.destination, error::error_code::success };
+			}
+
+			// Decodes a single point without any validation
+			// The source must start with a complete and valid code point, and the destination must have room for at least 1 point
+			static LINGO_CONSTEXPR14 decode_result_type decode_one_unchecked(decode_source_type source, decode_destination_type destination) noexcept
+			{
+				assert(source.size() >= 1);
+				assert(destination.size() >= 1);
+
+				// Calculate the size of the code point
+				const std::size_t required_size = unit_size(source[0]);
+				assert(required_size != 0);
+				assert(required_size <= source.size());
+
+				// Get the bits from the first unit
+				const unit_bits_type first_unit_bits = bit_converter_type::to_unit_bits(source[0]);
+				point_bits_type point_bits = first_unit_bits & first_unit_data_masks[required_size];
+
+				// Get the bits from all the continuation bytes
+				for (std::size_t i = 1; i < required_size; ++i)
+				{
+					point_bits <<= 6;
+					point_bits |= bit_converter_type::to_unit_bits(source[i]) & continuation_unit_data_mask;
+				}
+
+				// Store the point
+				destination[0] = bit_converter_type::from_point_bits(point_bits);
+				return { source.subspan(required_size), destination.subspan(1), error::error_code::success };
+			}
+
+			// Encodes a single point without any validation
+			// The source must start with a valid code point, and the destination must have room for at least max_units units
+			static LINGO_CONSTEXPR14 encode_result_type encode_one_unchecked(encode_source_type source, encode_destination_type destination) noexcept
+			{
+				assert(source.size() >= 1);
+
+				// Calculate the number of units needed to encode this point
+				const size_type required_size = point_size(source[0]);
+				assert(required_size != 0);
+				assert(required_size <= destination.size());
+
+				// Encode the first unit
+				point_bits_type point_bits = bit_converter_type::to_point_bits(source[0]);
+				const size_type last_index = required_size - 1;
+				destination[0] = bit_converter_type::from_unit_bits(first_unit_prefix_markers[required_size] | static_cast<unit_bits_type>(point_bits >> (6 * last_index)));
+
+				// Encode the subsequent units
+				for (size_t i = 1; i < required_size; ++i)
+				{
+					destination[i] = bit_converter_type::from_unit_bits(continuation_unit_prefix_marker | static_cast<unit_bits_type>((point_bits >> (6 * (last_index - i))) & continuation_unit_data_mask));
+				}
+
+				return { source.subspan(1), destination.subspan(required_size), error::error_code::success };
+			}
 		};
 
 		template <typename Unit, typename Point>
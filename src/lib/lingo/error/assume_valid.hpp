@@ -0,0 +1,71 @@
+#ifndef H_LINGO_ERROR_ASSUME_VALID
+#define H_LINGO_ERROR_ASSUME_VALID
+
+#include <lingo/platform/constexpr.hpp>
+
+#include <lingo/error/error_code.hpp>
+
+#include <lingo/utility/span.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+namespace lingo
+{
+	namespace error
+	{
+		// Marks input as already validated
+		// Users of this handler skip all validation and use the unchecked encode and decode functions instead
+		// Passing invalid input is undefined behaviour, which is only detected by assertions in debug builds
+		template <typename Encoding, typename Page>
+		struct assume_valid
+		{
+			using encoding_type = Encoding;
+			using page_type = Page;
+
+			using unit_type = typename encoding_type::unit_type;
+			using point_type = typename encoding_type::point_type;
+
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+
+			using encode_result_type = typename encoding_type::encode_result_type;
+			using decode_result_type = typename encoding_type::decode_result_type;
+			using encode_source_type = typename encoding_type::encode_source_type;
+			using decode_source_type = typename encoding_type::decode_source_type;
+			using encode_destination_type = typename encoding_type::encode_destination_type;
+			using decode_destination_type = typename encoding_type::decode_destination_type;
+
+			static LINGO_CONSTEXPR14 encode_result_type handle(
+				const encode_result_type& result,
+				encode_source_type,
+				encode_destination_type) noexcept
+			{
+				assert(result.error == error::error_code::success);
+				return result;
+			}
+
+			static LINGO_CONSTEXPR14 decode_result_type handle(
+				const decode_result_type& result,
+				decode_source_type,
+				decode_destination_type) noexcept
+			{
+				assert(result.error == error::error_code::success);
+				return result;
+			}
+		};
+
+		template <typename ErrorHandler>
+		struct is_assume_valid : std::false_type
+		{
+		};
+
+		template <typename Encoding, typename Page>
+		struct is_assume_valid<assume_valid<Encoding, Page>> : std::true_type
+		{
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,118 @@
+#ifndef H_LINGO_ERROR_ERROR_REPORT
+#define H_LINGO_ERROR_ERROR_REPORT
+
+#include <lingo/platform/constexpr.hpp>
+
+#include <lingo/error/error_code.hpp>
+
+#include <lingo/utility/span.hpp>
+
+#include <cstddef>
+
+namespace lingo
+{
+	namespace error
+	{
+		struct error_entry
+		{
+			// Offset of the offending unit(s) from the start of the source buffer
+			std::size_t source_offset;
+			error::error_code error;
+		};
+
+		// Collects the errors that occur during a conversion without ever allocating
+		// The first Capacity errors are stored with their location, all errors are counted per error code
+		// A report can be reused for multiple conversions by calling clear() in between
+		template <std::size_t Capacity>
+		class basic_error_report
+		{
+			public:
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+
+			static LINGO_CONSTEXPR11 size_type capacity = Capacity;
+			static LINGO_CONSTEXPR11 size_type error_code_count = static_cast<size_type>(error::error_code::no_mapping) + 1;
+
+			LINGO_CONSTEXPR14 basic_error_report() noexcept:
+				_entries{},
+				_counts{},
+				_size(0),
+				_total(0)
+			{
+			}
+
+			LINGO_CONSTEXPR14 void report(size_type source_offset, error::error_code error) noexcept
+			{
+				if (_size < capacity)
+				{
+					_entries[_size] = { source_offset, error };
+					++_size;
+				}
+
+				++_counts[static_cast<size_type>(error)];
+				++_total;
+			}
+
+			LINGO_CONSTEXPR14 void clear() noexcept
+			{
+				for (size_type i = 0; i < error_code_count; ++i)
+				{
+					_counts[i] = 0;
+				}
+
+				_size = 0;
+				_total = 0;
+			}
+
+			LINGO_CONSTEXPR14 utility::span<const error_entry> entries() const noexcept
+			{
+				return utility::span<const error_entry>(_entries, _size);
+			}
+
+			LINGO_CONSTEXPR14 size_type count(error::error_code error) const noexcept
+			{
+				return _counts[static_cast<size_type>(error)];
+			}
+
+			// Total number of errors reported, including the ones that did not fit
+			LINGO_CONSTEXPR14 size_type total() const noexcept
+			{
+				return _total;
+			}
+
+			// Number of errors that were counted, but whose location was not stored
+			LINGO_CONSTEXPR14 size_type dropped() const noexcept
+			{
+				return _total - _size;
+			}
+
+			LINGO_CONSTEXPR14 bool empty() const noexcept
+			{
+				return _total == 0;
+			}
+
+			private:
+			error_entry _entries[capacity > 0 ? capacity : 1];
+			size_type _counts[error_code_count];
+			size_type _size;
+			size_type _total;
+		};
+
+		template <std::size_t Capacity>
+		LINGO_CONSTEXPR11 typename basic_error_report<Capacity>::size_type basic_error_report<Capacity>::capacity;
+		template <std::size_t Capacity>
+		LINGO_CONSTEXPR11 typename basic_error_report<Capacity>::size_type basic_error_report<Capacity>::error_code_count;
+
+		using error_report = basic_error_report<64>;
+
+		// Error report that ignores everything, used when no report is requested
+		struct null_error_report
+		{
+			LINGO_CONSTEXPR14 void report(std::size_t, error::error_code) noexcept
+			{
+			}
+		};
+	}
+}
+
+#endif
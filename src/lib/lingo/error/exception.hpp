@@ -35,6 +35,7 @@ namespace lingo
 					case error_code::destination_buffer_too_small: return "destination buffer too small";
 					case error_code::invalid_point:                return "invalid point";
 					case error_code::invalid_unit:                 return "invalid unit";
+					case error_code::no_mapping:                   return "no mapping";
 					default:                                       return "unknown error code";
 				}
 			}
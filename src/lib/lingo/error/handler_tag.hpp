@@ -0,0 +1,17 @@
+#ifndef H_LINGO_ERROR_HANDLER_TAG
+#define H_LINGO_ERROR_HANDLER_TAG
+
+namespace lingo
+{
+	namespace error
+	{
+		// Selects an error handler for functions that cannot take it as an explicit template argument, such as constructors
+		// Example: lingo::utf32_string str(utf8_view, lingo::error::handler_tag<lingo::error::replace>());
+		template <template <typename, typename> class ErrorHandler>
+		struct handler_tag
+		{
+		};
+	}
+}
+
+#endif
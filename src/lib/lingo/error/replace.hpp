@@ -0,0 +1,117 @@
+#ifndef H_LINGO_ERROR_REPLACE
+#define H_LINGO_ERROR_REPLACE
+
+#include <lingo/platform/constexpr.hpp>
+
+#include <lingo/error/error_code.hpp>
+
+#include <lingo/page/unicode.hpp>
+
+#include <lingo/utility/span.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace lingo
+{
+	namespace error
+	{
+		// The point that error::replace inserts in place of invalid input
+		// Specialize this template to configure the replacement point for a code page
+		template <typename Page, typename Point, typename Enable = void>
+		struct replacement_point
+		{
+			static LINGO_CONSTEXPR11 Point value = static_cast<Point>('?');
+		};
+
+		template <typename Page, typename Point>
+		struct replacement_point<Page, Point, typename std::enable_if<utility::is_unicode<Page>::value>::type>
+		{
+			static LINGO_CONSTEXPR11 Point value = static_cast<Point>(0xFFFD);
+		};
+
+		template <typename Page, typename Point, typename Enable>
+		LINGO_CONSTEXPR11 Point replacement_point<Page, Point, Enable>::value;
+		template <typename Page, typename Point>
+		LINGO_CONSTEXPR11 Point replacement_point<Page, Point, typename std::enable_if<utility::is_unicode<Page>::value>::type>::value;
+
+		// Replaces invalid input with a replacement point
+		template <typename Encoding, typename Page>
+		struct replace
+		{
+			using encoding_type = Encoding;
+			using page_type = Page;
+
+			using unit_type = typename encoding_type::unit_type;
+			using point_type = typename encoding_type::point_type;
+
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+
+			using encode_result_type = typename encoding_type::encode_result_type;
+			using decode_result_type = typename encoding_type::decode_result_type;
+			using encode_source_type = typename encoding_type::encode_source_type;
+			using decode_source_type = typename encoding_type::decode_source_type;
+			using encode_destination_type = typename encoding_type::encode_destination_type;
+			using decode_destination_type = typename encoding_type::decode_destination_type;
+
+			static LINGO_CONSTEXPR11 point_type replacement = replacement_point<page_type, point_type>::value;
+
+			static LINGO_CONSTEXPR14 encode_result_type handle(
+				const encode_result_type& result,
+				encode_source_type source,
+				encode_destination_type destination) noexcept
+			{
+				// Running out of buffer space is not something that can be replaced
+				if (result.error == error::error_code::success ||
+					result.error == error::error_code::source_buffer_too_small ||
+					result.error == error::error_code::destination_buffer_too_small ||
+					source.size() == 0)
+				{
+					return result;
+				}
+
+				// Encode the replacement point instead
+				const point_type replacement_point = replacement;
+				const auto replacement_result = encoding_type::encode_one(encode_source_type(&replacement_point, 1), destination);
+				if (replacement_result.error != error::error_code::success)
+				{
+					return { source, destination, replacement_result.error };
+				}
+
+				return { source.subspan(1), replacement_result.destination, error::error_code::success };
+			}
+
+			static LINGO_CONSTEXPR14 decode_result_type handle(
+				const decode_result_type& result,
+				decode_source_type source,
+				decode_destination_type destination) noexcept
+			{
+				if (result.error == error::error_code::success ||
+					result.error == error::error_code::destination_buffer_too_small ||
+					source.size() == 0)
+				{
+					return result;
+				}
+
+				if (destination.size() == 0)
+				{
+					return { source, destination, error::error_code::destination_buffer_too_small };
+				}
+
+				// Write the replacement point
+				destination[0] = replacement;
+
+				// A truncated sequence at the end of the source is replaced as a whole,
+				// otherwise skip a single unit and try to resynchronize on the next one
+				const size_type skip_size = result.error == error::error_code::source_buffer_too_small ? source.size() : 1;
+				return { source.subspan(skip_size), destination.subspan(1), error::error_code::success };
+			}
+		};
+
+		template <typename Encoding, typename Page>
+		LINGO_CONSTEXPR11 typename replace<Encoding, Page>::point_type replace<Encoding, Page>::replacement;
+	}
+}
+
+#endif
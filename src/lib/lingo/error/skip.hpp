@@ -0,0 +1,75 @@
+#ifndef H_LINGO_ERROR_SKIP
+#define H_LINGO_ERROR_SKIP
+
+#include <lingo/platform/constexpr.hpp>
+
+#include <lingo/error/error_code.hpp>
+
+#include <lingo/utility/span.hpp>
+
+#include <cstddef>
+
+namespace lingo
+{
+	namespace error
+	{
+		// Silently drops invalid input
+		template <typename Encoding, typename Page>
+		struct skip
+		{
+			using encoding_type = Encoding;
+			using page_type = Page;
+
+			using unit_type = typename encoding_type::unit_type;
+			using point_type = typename encoding_type::point_type;
+
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+
+			using encode_result_type = typename encoding_type::encode_result_type;
+			using decode_result_type = typename encoding_type::decode_result_type;
+			using encode_source_type = typename encoding_type::encode_source_type;
+			using decode_source_type = typename encoding_type::decode_source_type;
+			using encode_destination_type = typename encoding_type::encode_destination_type;
+			using decode_destination_type = typename encoding_type::decode_destination_type;
+
+			static LINGO_CONSTEXPR14 encode_result_type handle(
+				const encode_result_type& result,
+				encode_source_type source,
+				encode_destination_type destination) noexcept
+			{
+				// Running out of buffer space is not something that can be skipped
+				if (result.error == error::error_code::success ||
+					result.error == error::error_code::source_buffer_too_small ||
+					result.error == error::error_code::destination_buffer_too_small ||
+					source.size() == 0)
+				{
+					return result;
+				}
+
+				// Drop the point without writing anything
+				return { source.subspan(1), destination, error::error_code::success };
+			}
+
+			static LINGO_CONSTEXPR14 decode_result_type handle(
+				const decode_result_type& result,
+				decode_source_type source,
+				decode_destination_type destination) noexcept
+			{
+				if (result.error == error::error_code::success ||
+					result.error == error::error_code::destination_buffer_too_small ||
+					source.size() == 0)
+				{
+					return result;
+				}
+
+				// A truncated sequence at the end of the source is dropped as a whole,
+				// otherwise skip a single unit and try to resynchronize on the next one
+				const size_type skip_size = result.error == error::error_code::source_buffer_too_small ? source.size() : 1;
+				return { source.subspan(skip_size), destination, error::error_code::success };
+			}
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,818 @@
+#ifndef H_LINGO_INPLACE_STRING
+#define H_LINGO_INPLACE_STRING
+
+#include <lingo/platform/constexpr.hpp>
+
+#include <lingo/point_set.hpp>
+#include <lingo/string.hpp>
+#include <lingo/string_view.hpp>
+
+#include <lingo/encoding/decode_back.hpp>
+#include <lingo/encoding/point_iterator.hpp>
+
+#include <lingo/error/error_code.hpp>
+#include <lingo/error/exception.hpp>
+#include <lingo/error/stop.hpp>
+
+#include <lingo/utility/item_traits.hpp>
+#include <lingo/utility/pointer_iterator.hpp>
+#include <lingo/utility/span.hpp>
+#include <lingo/utility/type_traits.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+namespace lingo
+{
+	// A string that stores up to Capacity units inside the object itself, and never allocates
+	// Operations that would need more room throw std::length_error, or use truncated() to cut the string at the last point that fits.
+	// The string is trivially copyable, so arrays of them can be copied with memcpy.
+	template <typename Encoding, typename Page, std::size_t Capacity>
+	class basic_inplace_string
+	{
+		public:
+		using encoding_type = Encoding;
+		using page_type = Page;
+
+		using unit_type = typename encoding_type::unit_type;
+		using point_type = typename encoding_type::point_type;
+
+		using value_type = unit_type;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using pointer = value_type*;
+		using const_pointer = const value_type*;
+
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+
+		struct iterator_tag;
+		using iterator = utility::pointer_iterator<value_type, iterator_tag>;
+		using const_iterator = utility::pointer_iterator<const value_type, iterator_tag>;
+		using reverse_iterator = std::reverse_iterator<iterator>;
+		using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+		static LINGO_CONSTEXPR11 const size_type npos = static_cast<size_type>(-1);
+		static LINGO_CONSTEXPR11 const unit_type null_terminator = unit_type{};
+
+		private:
+		static_assert(std::is_same<typename page_type::point_type, typename encoding_type::point_type>::value, "page_type::point_type must be the same type as encoding_type::point_type");
+		static_assert(Capacity > 0, "basic_inplace_string must have room for at least one unit");
+
+		using basic_string_view = lingo::basic_string_view<encoding_type, page_type>;
+		using copy_items = utility::copy_items<value_type>;
+		using point_iterator = encoding::point_iterator<encoding_type, error::stop<encoding_type, page_type>>;
+
+		static LINGO_CONSTEXPR11 const bool is_execution_set = lingo::utility::is_execution_set<encoding_type, page_type>::value;
+		static LINGO_CONSTEXPR11 const bool is_char_compatible = lingo::utility::is_char_compatible<encoding_type, page_type>::value;
+
+		public:
+		basic_inplace_string() noexcept:
+			_data{},
+			_size(0)
+		{
+		}
+
+		basic_inplace_string(size_type count, point_type point):
+			basic_inplace_string()
+		{
+			append(count, point);
+		}
+
+		basic_inplace_string(basic_string_view str):
+			basic_inplace_string()
+		{
+			append(str);
+		}
+
+		template <typename _ = int, typename std::enable_if<is_execution_set, _>::type = 0>
+		basic_inplace_string(const_pointer str):
+			basic_inplace_string(basic_string_view(str))
+		{
+		}
+
+		#if !defined(LINGO_DISABLE_CHAR_COMPATIBILITY)
+		template <typename _ = int, typename std::enable_if<is_char_compatible && is_execution_set, _>::type = 0, typename = void>
+		basic_inplace_string(const char* str):
+			basic_inplace_string(reinterpret_cast<const_pointer>(str))
+		{
+		}
+		#endif
+
+		// Strings with a smaller capacity always fit, larger ones are a compile time error
+		template <size_type OtherCapacity>
+		basic_inplace_string(const basic_inplace_string<encoding_type, page_type, OtherCapacity>& str) noexcept:
+			basic_inplace_string()
+		{
+			static_assert(OtherCapacity <= Capacity, "The source string can be larger than the capacity of the destination");
+			copy_items{}(_data, str.data(), str.size() + 1);
+			_size = str.size();
+		}
+
+		// Creates a string out of as many complete points of str as fit in the capacity
+		static basic_inplace_string truncated(basic_string_view str)
+		{
+			size_type fitting_size = str.size();
+			if (fitting_size > Capacity)
+			{
+				// The last point that starts within the capacity ends where the string is cut
+				fitting_size = 0;
+				for (point_iterator it(str), last; it != last && static_cast<size_type>(it.read_ptr() - str.data()) <= Capacity; ++it)
+				{
+					fitting_size = static_cast<size_type>(it.read_ptr() - str.data());
+				}
+			}
+
+			return basic_inplace_string(basic_string_view(str.data(), fitting_size, false));
+		}
+
+		iterator begin() noexcept
+		{
+			return iterator(data());
+		}
+
+		iterator end() noexcept
+		{
+			return iterator(data() + size());
+		}
+
+		const_iterator begin() const noexcept
+		{
+			return cbegin();
+		}
+
+		const_iterator end() const noexcept
+		{
+			return cend();
+		}
+
+		const_iterator cbegin() const noexcept
+		{
+			return const_iterator(data());
+		}
+
+		const_iterator cend() const noexcept
+		{
+			return const_iterator(data() + size());
+		}
+
+		reverse_iterator rbegin() noexcept
+		{
+			return reverse_iterator(end());
+		}
+
+		reverse_iterator rend() noexcept
+		{
+			return reverse_iterator(begin());
+		}
+
+		const_reverse_iterator crbegin() const noexcept
+		{
+			return const_reverse_iterator(cend());
+		}
+
+		const_reverse_iterator crend() const noexcept
+		{
+			return const_reverse_iterator(cbegin());
+		}
+
+		reference operator [] (size_type pos) noexcept
+		{
+			return _data[pos];
+		}
+
+		const_reference operator [] (size_type pos) const noexcept
+		{
+			return _data[pos];
+		}
+
+		reference at(size_type pos)
+		{
+			return const_cast<reference>(static_cast<const basic_inplace_string*>(this)->at(pos));
+		}
+
+		const_reference at(size_type pos) const
+		{
+			if (pos < size())
+			{
+				return operator[](pos);
+			}
+			else
+			{
+				throw std::out_of_range("Index out of range");
+			}
+		}
+
+		reference front() noexcept
+		{
+			return operator[](0);
+		}
+
+		const_reference front() const noexcept
+		{
+			return operator[](0);
+		}
+
+		reference back() noexcept
+		{
+			return operator[](size() - 1);
+		}
+
+		const_reference back() const noexcept
+		{
+			return operator[](size() - 1);
+		}
+
+		pointer data() noexcept
+		{
+			return _data;
+		}
+
+		const_pointer data() const noexcept
+		{
+			return _data;
+		}
+
+		const_pointer c_str() const noexcept
+		{
+			return _data;
+		}
+
+		size_type size() const noexcept
+		{
+			return _size;
+		}
+
+		size_type length() const noexcept
+		{
+			return _size;
+		}
+
+		static LINGO_CONSTEXPR11 size_type max_size() noexcept
+		{
+			return Capacity;
+		}
+
+		static LINGO_CONSTEXPR11 size_type capacity() noexcept
+		{
+			return Capacity;
+		}
+
+		bool empty() const noexcept
+		{
+			return _size == 0;
+		}
+
+		void resize(size_type new_size)
+		{
+			check_capacity(new_size);
+			if (new_size > _size)
+			{
+				std::fill(_data + _size, _data + new_size, null_terminator);
+			}
+
+			_data[new_size] = null_terminator;
+			_size = new_size;
+		}
+
+		void clear() noexcept
+		{
+			_data[0] = null_terminator;
+			_size = 0;
+		}
+
+		void assign(basic_string_view str)
+		{
+			replace_units(0, _size, str.data(), str.size());
+		}
+
+		void assign(basic_string_view str, size_type pos, size_type count = npos)
+		{
+			assign(str.substr(pos, count));
+		}
+
+		void assign(size_type count, point_type point)
+		{
+			replace(0, _size, count, point);
+		}
+
+		void append(basic_string_view str)
+		{
+			replace_units(_size, 0, str.data(), str.size());
+		}
+
+		void append(basic_string_view str, size_type pos, size_type count = npos)
+		{
+			append(str.substr(pos, count));
+		}
+
+		void append(size_type count, point_type point)
+		{
+			replace(_size, 0, count, point);
+		}
+
+		template <typename _ = int, typename std::enable_if<is_execution_set, _>::type = 0>
+		void append(const_pointer str)
+		{
+			append(basic_string_view(str));
+		}
+
+		#if !defined(LINGO_DISABLE_CHAR_COMPATIBILITY)
+		template <typename _ = int, typename std::enable_if<is_execution_set && is_char_compatible, _>::type = 0, typename = void>
+		void append(const char* str)
+		{
+			append(reinterpret_cast<const_pointer>(str));
+		}
+		#endif
+
+		basic_inplace_string& operator += (basic_string_view str)
+		{
+			append(str);
+			return *this;
+		}
+
+		basic_inplace_string& operator += (point_type point)
+		{
+			push_back(point);
+			return *this;
+		}
+
+		basic_inplace_string& insert(size_type index, size_type count, point_type point)
+		{
+			return replace(index, 0, count, point);
+		}
+
+		basic_inplace_string& insert(size_type index, basic_string_view str)
+		{
+			return replace(index, 0, str);
+		}
+
+		basic_inplace_string& insert(size_type index, basic_string_view str, size_type pos, size_type count = npos)
+		{
+			return replace(index, 0, str, pos, count);
+		}
+
+		iterator insert(const_iterator position, point_type point)
+		{
+			return insert(position, 1, point);
+		}
+
+		iterator insert(const_iterator position, size_type count, point_type point)
+		{
+			const size_type index = static_cast<size_type>(position - cbegin());
+			insert(index, count, point);
+			return begin() + static_cast<difference_type>(index);
+		}
+
+		basic_inplace_string& erase(size_type index = 0, size_type count = npos)
+		{
+			check_index(index);
+			move_tail(index, (std::min)(count, _size - index), 0);
+			return *this;
+		}
+
+		// Erases a single unit
+		iterator erase(const_iterator position)
+		{
+			return erase(position, position + 1);
+		}
+
+		iterator erase(const_iterator first, const_iterator last)
+		{
+			const size_type index = static_cast<size_type>(first - cbegin());
+			move_tail(index, static_cast<size_type>(last - first), 0);
+			return begin() + static_cast<difference_type>(index);
+		}
+
+		// Replaces count units at pos with str, moving the units behind them within the buffer
+		basic_inplace_string& replace(size_type pos, size_type count, basic_string_view str)
+		{
+			check_index(pos);
+			replace_units(pos, (std::min)(count, _size - pos), str.data(), str.size());
+			return *this;
+		}
+
+		basic_inplace_string& replace(size_type pos, size_type count, basic_string_view str, size_type str_pos, size_type str_count = npos)
+		{
+			return replace(pos, count, str.substr(str_pos, str_count));
+		}
+
+		basic_inplace_string& replace(size_type pos, size_type count, size_type point_count, point_type point)
+		{
+			check_index(pos);
+			count = (std::min)(count, _size - pos);
+
+			// Encode the point into units
+			unit_type encoded_point[encoding_type::max_units];
+			const size_type point_size = encode_point(point, encoded_point);
+			if (point_count > 0 && point_size > (Capacity - (_size - count)) / point_count)
+			{
+				throw std::length_error("basic_inplace_string is too small");
+			}
+
+			move_tail(pos, count, point_size * point_count);
+			for (size_type i = 0; i < point_count; ++i)
+			{
+				copy_items{}(_data + pos + i * point_size, encoded_point, point_size);
+			}
+
+			return *this;
+		}
+
+		basic_inplace_string& replace(const_iterator first, const_iterator last, basic_string_view str)
+		{
+			return replace(static_cast<size_type>(first - cbegin()), static_cast<size_type>(last - first), str);
+		}
+
+		void push_back(point_type point)
+		{
+			replace(_size, 0, 1, point);
+		}
+
+		// Removes the last point
+		// If the last units do not form a valid point, only the last unit is removed
+		template <typename _ = int, typename std::enable_if<encoding::has_decode_back<encoding_type>::value, _>::type = 0>
+		void pop_back() noexcept
+		{
+			assert(!empty());
+
+			point_type point{};
+			const auto result = encoding_type::decode_one_back(utility::span<const unit_type>(_data, _size), utility::span<point_type>(&point, 1));
+			_size = result.error == error::error_code::success ? result.source.size() : _size - 1;
+			_data[_size] = null_terminator;
+		}
+
+		basic_inplace_string substr(size_type pos = 0, size_type count = npos) const
+		{
+			return basic_inplace_string(view().substr(pos, count));
+		}
+
+		size_type copy(value_type* dest, size_type count, size_type pos = 0) const
+		{
+			return view().copy(dest, count, pos);
+		}
+
+		int compare(basic_string_view str) const noexcept(noexcept(std::declval<const basic_string_view&>().compare(str)))
+		{
+			return view().compare(str);
+		}
+
+		template <typename _ = int, typename std::enable_if<is_execution_set, _>::type = 0>
+		int compare(const_pointer str) const noexcept(noexcept(std::declval<const basic_inplace_string&>().compare(basic_string_view(str))))
+		{
+			return compare(basic_string_view(str));
+		}
+
+		#if !defined(LINGO_DISABLE_CHAR_COMPATIBILITY)
+		template <typename _ = int, typename std::enable_if<is_execution_set && is_char_compatible, _>::type = 0, typename = void>
+		int compare(const char* str) const noexcept(noexcept(std::declval<const basic_inplace_string&>().compare(reinterpret_cast<const_pointer>(str))))
+		{
+			return compare(reinterpret_cast<const_pointer>(str));
+		}
+		#endif
+
+		size_type find(basic_string_view str, size_type pos = 0) const noexcept
+		{
+			return view().find(str, pos);
+		}
+
+		template <typename _ = int, typename std::enable_if<is_execution_set, _>::type = 0>
+		size_type find(const_pointer str, size_type pos = 0) const noexcept
+		{
+			return find(basic_string_view(str), pos);
+		}
+
+		template <typename _ = int, typename std::enable_if<is_execution_set, _>::type = 0>
+		size_type find(const_pointer str, size_type pos, size_type count) const noexcept
+		{
+			return find(basic_string_view(str, count, false), pos);
+		}
+
+		#if !defined(LINGO_DISABLE_CHAR_COMPATIBILITY)
+		template <typename _ = int, typename std::enable_if<is_execution_set && is_char_compatible, _>::type = 0, typename = void>
+		size_type find(const char* str, size_type pos = 0) const noexcept
+		{
+			return find(reinterpret_cast<const_pointer>(str), pos);
+		}
+
+		template <typename _ = int, typename std::enable_if<is_execution_set && is_char_compatible, _>::type = 0, typename = void>
+		size_type find(const char* str, size_type pos, size_type count) const noexcept
+		{
+			return find(reinterpret_cast<const_pointer>(str), pos, count);
+		}
+		#endif
+
+		size_type rfind(basic_string_view str, size_type pos = npos) const noexcept
+		{
+			return view().rfind(str, pos);
+		}
+
+		template <typename _ = int, typename std::enable_if<is_execution_set, _>::type = 0>
+		size_type rfind(const_pointer str, size_type pos = npos) const noexcept
+		{
+			return rfind(basic_string_view(str), pos);
+		}
+
+		template <typename _ = int, typename std::enable_if<is_execution_set, _>::type = 0>
+		size_type rfind(const_pointer str, size_type pos, size_type count) const noexcept
+		{
+			return rfind(basic_string_view(str, count, false), pos);
+		}
+
+		#if !defined(LINGO_DISABLE_CHAR_COMPATIBILITY)
+		template <typename _ = int, typename std::enable_if<is_execution_set && is_char_compatible, _>::type = 0, typename = void>
+		size_type rfind(const char* str, size_type pos = npos) const noexcept
+		{
+			return rfind(reinterpret_cast<const_pointer>(str), pos);
+		}
+
+		template <typename _ = int, typename std::enable_if<is_execution_set && is_char_compatible, _>::type = 0, typename = void>
+		size_type rfind(const char* str, size_type pos, size_type count) const noexcept
+		{
+			return rfind(reinterpret_cast<const_pointer>(str), pos, count);
+		}
+		#endif
+
+		size_type find_first_of(const point_set<point_type>& points, size_type pos = 0) const noexcept
+		{
+			return view().find_first_of(points, pos);
+		}
+
+		size_type find_first_of(basic_string_view str, size_type pos = 0) const
+		{
+			return view().find_first_of(str, pos);
+		}
+
+		size_type find_first_not_of(const point_set<point_type>& points, size_type pos = 0) const noexcept
+		{
+			return view().find_first_not_of(points, pos);
+		}
+
+		size_type find_first_not_of(basic_string_view str, size_type pos = 0) const
+		{
+			return view().find_first_not_of(str, pos);
+		}
+
+		size_type find_last_of(const point_set<point_type>& points, size_type pos = npos) const noexcept
+		{
+			return view().find_last_of(points, pos);
+		}
+
+		size_type find_last_of(basic_string_view str, size_type pos = npos) const
+		{
+			return view().find_last_of(str, pos);
+		}
+
+		size_type find_last_not_of(const point_set<point_type>& points, size_type pos = npos) const noexcept
+		{
+			return view().find_last_not_of(points, pos);
+		}
+
+		size_type find_last_not_of(basic_string_view str, size_type pos = npos) const
+		{
+			return view().find_last_not_of(str, pos);
+		}
+
+		bool starts_with(basic_string_view str) const noexcept
+		{
+			return view().starts_with(str);
+		}
+
+		bool ends_with(basic_string_view str) const noexcept
+		{
+			return view().ends_with(str);
+		}
+
+		basic_string_view view() const noexcept
+		{
+			return basic_string_view(_data, _size, true);
+		}
+
+		operator basic_string_view() const noexcept
+		{
+			return view();
+		}
+
+		template <typename Allocator = internal::default_allocator<encoding_type>, typename Layout = string_layout::standard>
+		basic_string<encoding_type, page_type, Allocator, Layout> str(const Allocator& allocator = Allocator()) const
+		{
+			return basic_string<encoding_type, page_type, Allocator, Layout>(view(), allocator);
+		}
+
+		private:
+		static void check_capacity(size_type required_size)
+		{
+			if (required_size > Capacity)
+			{
+				throw std::length_error("basic_inplace_string is too small");
+			}
+		}
+
+		void check_index(size_type index) const
+		{
+			if (index > _size)
+			{
+				throw std::out_of_range("index > size()");
+			}
+		}
+
+		static size_type encode_point(point_type point, unit_type (&units)[encoding_type::max_units])
+		{
+			const auto result = encoding_type::encode_one(utility::span<const point_type>(&point, 1), units);
+			if (result.error != error::error_code::success)
+			{
+				throw error::exception(result.error);
+			}
+
+			return static_cast<size_type>(result.destination.data() - units);
+		}
+
+		// Replaces removed units at pos with inserted uninitialized units, moving the units behind them and the null terminator
+		// The caller makes sure that the new size fits in the capacity
+		void move_tail(size_type pos, size_type removed, size_type inserted) noexcept
+		{
+			const size_type new_size = _size - removed + inserted;
+			if (inserted > removed)
+			{
+				std::copy_backward(_data + pos + removed, _data + _size + 1, _data + new_size + 1);
+			}
+			else if (inserted < removed)
+			{
+				std::copy(_data + pos + removed, _data + _size + 1, _data + pos + inserted);
+			}
+
+			_size = new_size;
+		}
+
+		void replace_units(size_type pos, size_type count, const_pointer source, size_type source_size)
+		{
+			if (source_size > Capacity - (_size - count))
+			{
+				throw std::length_error("basic_inplace_string is too small");
+			}
+
+			// The source could move while the units are shifted, so copy it out of this string first
+			if (source_size > 0 && source >= _data && source <= _data + _size)
+			{
+				const basic_inplace_string copy(basic_string_view(source, source_size, false));
+				replace_units(pos, count, copy.data(), source_size);
+				return;
+			}
+
+			move_tail(pos, count, source_size);
+			copy_items{}(_data + pos, source, source_size);
+		}
+
+		unit_type _data[Capacity + 1];
+		size_type _size;
+	};
+
+	template <typename Encoding, typename Page, std::size_t Capacity>
+	LINGO_CONSTEXPR11 const typename basic_inplace_string<Encoding, Page, Capacity>::size_type basic_inplace_string<Encoding, Page, Capacity>::npos;
+	template <typename Encoding, typename Page, std::size_t Capacity>
+	LINGO_CONSTEXPR11 const typename basic_inplace_string<Encoding, Page, Capacity>::unit_type basic_inplace_string<Encoding, Page, Capacity>::null_terminator;
+	template <typename Encoding, typename Page, std::size_t Capacity>
+	LINGO_CONSTEXPR11 const bool basic_inplace_string<Encoding, Page, Capacity>::is_execution_set;
+	template <typename Encoding, typename Page, std::size_t Capacity>
+	LINGO_CONSTEXPR11 const bool basic_inplace_string<Encoding, Page, Capacity>::is_char_compatible;
+
+	template <typename Encoding, typename Page, std::size_t LeftCapacity, std::size_t RightCapacity>
+	bool operator == (const basic_inplace_string<Encoding, Page, LeftCapacity>& left, const basic_inplace_string<Encoding, Page, RightCapacity>& right) noexcept(noexcept(left.compare(right)))
+	{
+		return left.view() == right.view();
+	}
+
+	template <typename Encoding, typename Page, std::size_t LeftCapacity, std::size_t RightCapacity>
+	bool operator != (const basic_inplace_string<Encoding, Page, LeftCapacity>& left, const basic_inplace_string<Encoding, Page, RightCapacity>& right) noexcept(noexcept(left.compare(right)))
+	{
+		return left.view() != right.view();
+	}
+
+	template <typename Encoding, typename Page, std::size_t LeftCapacity, std::size_t RightCapacity>
+	bool operator < (const basic_inplace_string<Encoding, Page, LeftCapacity>& left, const basic_inplace_string<Encoding, Page, RightCapacity>& right) noexcept(noexcept(left.compare(right)))
+	{
+		return left.compare(right) < 0;
+	}
+
+	template <typename Encoding, typename Page, std::size_t LeftCapacity, std::size_t RightCapacity>
+	bool operator > (const basic_inplace_string<Encoding, Page, LeftCapacity>& left, const basic_inplace_string<Encoding, Page, RightCapacity>& right) noexcept(noexcept(left.compare(right)))
+	{
+		return left.compare(right) > 0;
+	}
+
+	template <typename Encoding, typename Page, std::size_t LeftCapacity, std::size_t RightCapacity>
+	bool operator <= (const basic_inplace_string<Encoding, Page, LeftCapacity>& left, const basic_inplace_string<Encoding, Page, RightCapacity>& right) noexcept(noexcept(left.compare(right)))
+	{
+		return left.compare(right) <= 0;
+	}
+
+	template <typename Encoding, typename Page, std::size_t LeftCapacity, std::size_t RightCapacity>
+	bool operator >= (const basic_inplace_string<Encoding, Page, LeftCapacity>& left, const basic_inplace_string<Encoding, Page, RightCapacity>& right) noexcept(noexcept(left.compare(right)))
+	{
+		return left.compare(right) >= 0;
+	}
+
+	template <typename Encoding, typename Page, std::size_t Capacity>
+	bool operator == (const basic_inplace_string<Encoding, Page, Capacity>& left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
+	{
+		return left.view() == right;
+	}
+
+	template <typename Encoding, typename Page, std::size_t Capacity>
+	bool operator != (const basic_inplace_string<Encoding, Page, Capacity>& left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
+	{
+		return left.view() != right;
+	}
+
+	template <typename Encoding, typename Page, std::size_t Capacity>
+	bool operator < (const basic_inplace_string<Encoding, Page, Capacity>& left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
+	{
+		return left.compare(right) < 0;
+	}
+
+	template <typename Encoding, typename Page, std::size_t Capacity>
+	bool operator > (const basic_inplace_string<Encoding, Page, Capacity>& left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
+	{
+		return left.compare(right) > 0;
+	}
+
+	template <typename Encoding, typename Page, std::size_t Capacity>
+	bool operator <= (const basic_inplace_string<Encoding, Page, Capacity>& left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
+	{
+		return left.compare(right) <= 0;
+	}
+
+	template <typename Encoding, typename Page, std::size_t Capacity>
+	bool operator >= (const basic_inplace_string<Encoding, Page, Capacity>& left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
+	{
+		return left.compare(right) >= 0;
+	}
+
+	template <typename Encoding, typename Page, std::size_t Capacity>
+	bool operator == (basic_string_view<Encoding, Page> left, const basic_inplace_string<Encoding, Page, Capacity>& right) noexcept(noexcept(right.compare(left)))
+	{
+		return left == right.view();
+	}
+
+	template <typename Encoding, typename Page, std::size_t Capacity>
+	bool operator != (basic_string_view<Encoding, Page> left, const basic_inplace_string<Encoding, Page, Capacity>& right) noexcept(noexcept(right.compare(left)))
+	{
+		return left != right.view();
+	}
+
+	template <typename Encoding, typename Page, std::size_t Capacity>
+	bool operator < (basic_string_view<Encoding, Page> left, const basic_inplace_string<Encoding, Page, Capacity>& right) noexcept(noexcept(right.compare(left)))
+	{
+		return right.compare(left) > 0;
+	}
+
+	template <typename Encoding, typename Page, std::size_t Capacity>
+	bool operator > (basic_string_view<Encoding, Page> left, const basic_inplace_string<Encoding, Page, Capacity>& right) noexcept(noexcept(right.compare(left)))
+	{
+		return right.compare(left) < 0;
+	}
+
+	template <typename Encoding, typename Page, std::size_t Capacity>
+	bool operator <= (basic_string_view<Encoding, Page> left, const basic_inplace_string<Encoding, Page, Capacity>& right) noexcept(noexcept(right.compare(left)))
+	{
+		return right.compare(left) >= 0;
+	}
+
+	template <typename Encoding, typename Page, std::size_t Capacity>
+	bool operator >= (basic_string_view<Encoding, Page> left, const basic_inplace_string<Encoding, Page, Capacity>& right) noexcept(noexcept(right.compare(left)))
+	{
+		return right.compare(left) <= 0;
+	}
+
+	// Fixed page typedefs
+	template <typename Encoding, std::size_t Capacity>
+	using basic_unicode_inplace_string = basic_inplace_string<Encoding, page::unicode_default, Capacity>;
+
+	// Fixed encoding typedefs
+	template <typename Unit, std::size_t Capacity>
+	using basic_utf8_inplace_string = basic_unicode_inplace_string<encoding::utf8<Unit, char32_t>, Capacity>;
+	template <typename Unit, std::size_t Capacity>
+	using basic_utf16_inplace_string = basic_unicode_inplace_string<encoding::utf16<Unit, char32_t>, Capacity>;
+	template <typename Unit, std::size_t Capacity>
+	using basic_utf32_inplace_string = basic_unicode_inplace_string<encoding::utf32<Unit, char32_t>, Capacity>;
+
+	// Fully specialized typedefs
+	#ifdef __cpp_char8_t
+	template <std::size_t Capacity>
+	using utf8_inplace_string = basic_utf8_inplace_string<char8_t, Capacity>;
+	#else
+	template <std::size_t Capacity>
+	using utf8_inplace_string = basic_utf8_inplace_string<char, Capacity>;
+	#endif
+
+	template <std::size_t Capacity>
+	using utf16_inplace_string = basic_utf16_inplace_string<char16_t, Capacity>;
+	template <std::size_t Capacity>
+	using utf32_inplace_string = basic_utf32_inplace_string<char32_t, Capacity>;
+}
+
+#endif
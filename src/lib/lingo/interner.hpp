@@ -0,0 +1,317 @@
+#ifndef H_LINGO_INTERNER
+#define H_LINGO_INTERNER
+
+#include <lingo/platform/constexpr.hpp>
+
+#include <lingo/monotonic_text_arena.hpp>
+#include <lingo/string_view.hpp>
+
+#include <lingo/utility/item_traits.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace lingo
+{
+	// Deduplicates strings and hands out 32 bit handles for them
+	// The units of every distinct string are stored once in an arena, and stay valid until the interner is destroyed.
+	// The interner is split into shards that each have their own lock, so threads that intern different strings rarely wait on each other.
+	// Turning a handle back into a view never takes a lock.
+	template <typename Encoding, typename Page>
+	class basic_interner
+	{
+		public:
+		using encoding_type = Encoding;
+		using page_type = Page;
+
+		using unit_type = typename encoding_type::unit_type;
+
+		using size_type = std::size_t;
+		using handle_type = std::uint32_t;
+
+		using string_view_type = basic_string_view<encoding_type, page_type>;
+
+		// The lowest bits of a handle select the shard, the other bits the string within the shard
+		static LINGO_CONSTEXPR11 const size_type shard_bits = 4;
+		static LINGO_CONSTEXPR11 const size_type shard_count = size_type(1) << shard_bits;
+
+		// Returned by find() for strings that have not been interned
+		static LINGO_CONSTEXPR11 const handle_type invalid_handle = static_cast<handle_type>(-1);
+
+		private:
+		using copy_items = utility::copy_items<unit_type>;
+		using mismatch_items = utility::mismatch_items<unit_type>;
+
+		struct entry
+		{
+			const unit_type* data;
+			size_type size;
+			std::uint64_t hash;
+		};
+
+		// Entries are stored in segments that double in size and never move,
+		// so readers can find an entry while another thread adds new ones
+		static LINGO_CONSTEXPR11 const size_type first_segment_bits = 6;
+		static LINGO_CONSTEXPR11 const size_type segment_count = 32 - shard_bits - first_segment_bits + 1;
+		static LINGO_CONSTEXPR11 const size_type max_shard_size = (size_type(1) << (32 - shard_bits)) - 1;
+
+		struct shard
+		{
+			shard() noexcept:
+				size(0),
+				segments{}
+			{
+			}
+
+			~shard()
+			{
+				for (std::atomic<entry*>& segment : segments)
+				{
+					delete[] segment.load(std::memory_order_relaxed);
+				}
+			}
+
+			std::mutex mutex;
+			monotonic_text_arena arena;
+			size_type size;
+			std::atomic<entry*> segments[segment_count];
+
+			// Open addressing table of entry index + 1, 0 marks an empty slot
+			std::vector<std::uint32_t> slots;
+		};
+
+		public:
+		basic_interner() = default;
+
+		basic_interner(const basic_interner&) = delete;
+		basic_interner& operator = (const basic_interner&) = delete;
+
+		// Returns the handle of the string, and stores the string if it has not been interned before
+		handle_type intern(string_view_type str)
+		{
+			const std::uint64_t hash = hash_units(str);
+			const size_type shard_index = select_shard(hash);
+			shard& current = _shards[shard_index];
+
+			std::lock_guard<std::mutex> lock(current.mutex);
+			size_type slot = 0;
+			const size_type found = find_entry(current, str, hash, slot);
+			if (found != max_shard_size)
+			{
+				return make_handle(shard_index, found);
+			}
+
+			if (current.size == max_shard_size)
+			{
+				throw std::length_error("basic_interner is full");
+			}
+
+			// Copy the units into the arena
+			unit_type* const units = static_cast<unit_type*>(current.arena.allocate((str.size() + 1) * sizeof(unit_type), alignof(unit_type)));
+			LINGO_CONSTEXPR11 const unit_type null_terminator{};
+			copy_items{}(units, str.data(), str.size());
+			copy_items{}(units + str.size(), &null_terminator, 1);
+
+			// Add the entry, segments are never moved so view() can read it without taking the lock
+			const size_type index = current.size;
+			size_type offset = 0;
+			const size_type segment_index = locate(index, offset);
+			entry* segment = current.segments[segment_index].load(std::memory_order_relaxed);
+			if (segment == nullptr)
+			{
+				segment = new entry[segment_size(segment_index)];
+			}
+			segment[offset] = entry{ units, str.size(), hash };
+			current.segments[segment_index].store(segment, std::memory_order_release);
+			++current.size;
+
+			// Keep the table at most half full
+			if (current.size * 2 > current.slots.size())
+			{
+				rehash(current);
+			}
+			else
+			{
+				current.slots[slot] = static_cast<std::uint32_t>(index + 1);
+			}
+
+			return make_handle(shard_index, index);
+		}
+
+		// Looks up a string without storing it
+		handle_type find(string_view_type str) const
+		{
+			const std::uint64_t hash = hash_units(str);
+			const size_type shard_index = select_shard(hash);
+			shard& current = _shards[shard_index];
+
+			std::lock_guard<std::mutex> lock(current.mutex);
+			size_type slot = 0;
+			const size_type found = find_entry(current, str, hash, slot);
+			return found != max_shard_size ? make_handle(shard_index, found) : invalid_handle;
+		}
+
+		// Returns the null terminated string of a handle that was returned by intern()
+		string_view_type view(handle_type handle) const noexcept
+		{
+			const shard& current = _shards[handle & (shard_count - 1)];
+			size_type offset = 0;
+			const size_type segment_index = locate(handle >> shard_bits, offset);
+			const entry& found = current.segments[segment_index].load(std::memory_order_acquire)[offset];
+			return string_view_type(found.data, found.size, true);
+		}
+
+		string_view_type operator [] (handle_type handle) const noexcept
+		{
+			return view(handle);
+		}
+
+		// The amount of distinct strings
+		size_type size() const
+		{
+			size_type total = 0;
+			for (shard& current : _shards)
+			{
+				std::lock_guard<std::mutex> lock(current.mutex);
+				total += current.size;
+			}
+			return total;
+		}
+
+		private:
+		// FNV-1a over the values of the units
+		static std::uint64_t hash_units(string_view_type str) noexcept
+		{
+			using unit_key_type = typename std::make_unsigned<unit_type>::type;
+
+			std::uint64_t hash = 14695981039346656037ull;
+			for (size_type i = 0; i < str.size(); ++i)
+			{
+				hash ^= static_cast<std::uint64_t>(static_cast<unit_key_type>(str.data()[i]));
+				hash *= 1099511628211ull;
+			}
+			return hash;
+		}
+
+		// The highest bits pick the shard, so that the lowest bits are still spread out within a shard
+		static size_type select_shard(std::uint64_t hash) noexcept
+		{
+			return static_cast<size_type>(hash >> (64 - shard_bits));
+		}
+
+		static handle_type make_handle(size_type shard_index, size_type index) noexcept
+		{
+			return static_cast<handle_type>((index << shard_bits) | shard_index);
+		}
+
+		static size_type segment_size(size_type segment_index) noexcept
+		{
+			return size_type(1) << (segment_index + first_segment_bits);
+		}
+
+		// Segment s holds the entries from 2^(s + first_segment_bits) - 2^first_segment_bits onwards
+		static size_type locate(size_type index, size_type& offset) noexcept
+		{
+			const size_type position = index + (size_type(1) << first_segment_bits);
+			size_type segment_index = 0;
+			while ((position >> (segment_index + first_segment_bits + 1)) != 0)
+			{
+				++segment_index;
+			}
+			offset = position - segment_size(segment_index);
+			return segment_index;
+		}
+
+		static const entry& get_entry(const shard& current, size_type index) noexcept
+		{
+			size_type offset = 0;
+			const size_type segment_index = locate(index, offset);
+			return current.segments[segment_index].load(std::memory_order_relaxed)[offset];
+		}
+
+		// Returns the index of the matching entry or max_shard_size, slot is set to where the string belongs in the table
+		static size_type find_entry(const shard& current, string_view_type str, std::uint64_t hash, size_type& slot) noexcept
+		{
+			if (current.slots.empty())
+			{
+				return max_shard_size;
+			}
+
+			const size_type mask = current.slots.size() - 1;
+			for (slot = static_cast<size_type>(hash) & mask; current.slots[slot] != 0; slot = (slot + 1) & mask)
+			{
+				const size_type index = current.slots[slot] - 1;
+				const entry& candidate = get_entry(current, index);
+				if (candidate.hash == hash && candidate.size == str.size() && mismatch_items{}(candidate.data, str.data(), str.size()) == str.size())
+				{
+					return index;
+				}
+			}
+			return max_shard_size;
+		}
+
+		static void rehash(shard& current)
+		{
+			std::vector<std::uint32_t> slots((std::max)(current.slots.size() * 2, size_type(64)), 0);
+			const size_type mask = slots.size() - 1;
+			for (size_type index = 0; index < current.size; ++index)
+			{
+				size_type slot = static_cast<size_type>(get_entry(current, index).hash) & mask;
+				while (slots[slot] != 0)
+				{
+					slot = (slot + 1) & mask;
+				}
+				slots[slot] = static_cast<std::uint32_t>(index + 1);
+			}
+			current.slots.swap(slots);
+		}
+
+		mutable shard _shards[shard_count];
+	};
+
+	template <typename Encoding, typename Page>
+	LINGO_CONSTEXPR11 const typename basic_interner<Encoding, Page>::size_type basic_interner<Encoding, Page>::shard_bits;
+	template <typename Encoding, typename Page>
+	LINGO_CONSTEXPR11 const typename basic_interner<Encoding, Page>::size_type basic_interner<Encoding, Page>::shard_count;
+	template <typename Encoding, typename Page>
+	LINGO_CONSTEXPR11 const typename basic_interner<Encoding, Page>::handle_type basic_interner<Encoding, Page>::invalid_handle;
+	template <typename Encoding, typename Page>
+	LINGO_CONSTEXPR11 const typename basic_interner<Encoding, Page>::size_type basic_interner<Encoding, Page>::first_segment_bits;
+	template <typename Encoding, typename Page>
+	LINGO_CONSTEXPR11 const typename basic_interner<Encoding, Page>::size_type basic_interner<Encoding, Page>::segment_count;
+	template <typename Encoding, typename Page>
+	LINGO_CONSTEXPR11 const typename basic_interner<Encoding, Page>::size_type basic_interner<Encoding, Page>::max_shard_size;
+
+	// Fixed page typedefs
+	template <typename Encoding>
+	using basic_unicode_interner = basic_interner<Encoding, page::unicode_default>;
+
+	// Fixed encoding typedefs
+	template <typename Unit>
+	using basic_utf8_interner = basic_unicode_interner<encoding::utf8<Unit, char32_t>>;
+	template <typename Unit>
+	using basic_utf16_interner = basic_unicode_interner<encoding::utf16<Unit, char32_t>>;
+	template <typename Unit>
+	using basic_utf32_interner = basic_unicode_interner<encoding::utf32<Unit, char32_t>>;
+
+	// Fully specialized typedefs
+	#ifdef __cpp_char8_t
+	using utf8_interner = basic_utf8_interner<char8_t>;
+	#else
+	using utf8_interner = basic_utf8_interner<char>;
+	#endif
+
+	using utf16_interner = basic_utf16_interner<char16_t>;
+	using utf32_interner = basic_utf32_interner<char32_t>;
+
+	// Default interner typedef
+	using interner = utf8_interner;
+}
+
+#endif
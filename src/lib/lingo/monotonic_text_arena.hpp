@@ -0,0 +1,202 @@
+#ifndef H_LINGO_MONOTONIC_TEXT_ARENA
+#define H_LINGO_MONOTONIC_TEXT_ARENA
+
+#include <lingo/platform/constexpr.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace lingo
+{
+	// Hands out memory for strings that all die at the same time, such as the strings of a single request
+	// Allocations bump a pointer through large blocks, and the memory is only given back to the system
+	// when the arena is released or destroyed. Strings use the arena through arena_allocator.
+	class monotonic_text_arena
+	{
+		public:
+		using size_type = std::size_t;
+
+		static LINGO_CONSTEXPR11 const size_type default_block_size = 4096;
+
+		explicit monotonic_text_arena(size_type initial_block_size = default_block_size) noexcept:
+			_blocks(nullptr),
+			_current(nullptr),
+			_end(nullptr),
+			_initial_block_size(initial_block_size > 0 ? initial_block_size : static_cast<size_type>(default_block_size)),
+			_next_block_size(_initial_block_size)
+		{
+		}
+
+		// Allocators refer to the arena, so it cannot be copied or moved
+		monotonic_text_arena(const monotonic_text_arena&) = delete;
+		monotonic_text_arena& operator = (const monotonic_text_arena&) = delete;
+
+		~monotonic_text_arena()
+		{
+			release();
+		}
+
+		void* allocate(size_type size, size_type alignment)
+		{
+			unsigned char* result = align(_current, alignment);
+			if (_current == nullptr || result > _end || size > static_cast<size_type>(_end - result))
+			{
+				add_block(size + alignment);
+				result = align(_current, alignment);
+			}
+
+			_current = result + size;
+			return result;
+		}
+
+		// Only the most recent allocation is given back, which covers a string that is freed right after it was created
+		void deallocate(void* pointer, size_type size) noexcept
+		{
+			unsigned char* const data = static_cast<unsigned char*>(pointer);
+			if (data + size == _current)
+			{
+				_current = data;
+			}
+		}
+
+		// Frees all blocks at once, all memory that was allocated from the arena becomes invalid
+		void release() noexcept
+		{
+			while (_blocks != nullptr)
+			{
+				block_header* const previous = _blocks->previous;
+				::operator delete(_blocks);
+				_blocks = previous;
+			}
+
+			_current = nullptr;
+			_end = nullptr;
+			_next_block_size = _initial_block_size;
+		}
+
+		size_type block_count() const noexcept
+		{
+			size_type count = 0;
+			for (const block_header* block = _blocks; block != nullptr; block = block->previous)
+			{
+				++count;
+			}
+			return count;
+		}
+
+		private:
+		struct block_header
+		{
+			block_header* previous;
+			size_type size;
+		};
+
+		static unsigned char* align(unsigned char* pointer, size_type alignment) noexcept
+		{
+			const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(pointer);
+			const std::uintptr_t aligned = (address + (alignment - 1)) & ~static_cast<std::uintptr_t>(alignment - 1);
+			return pointer + (aligned - address);
+		}
+
+		// Every block is at least twice as large as the previous one, so the amount of blocks stays small
+		void add_block(size_type minimum_size)
+		{
+			size_type size = _next_block_size;
+			while (size < minimum_size)
+			{
+				if (size > (std::numeric_limits<size_type>::max)() / 2)
+				{
+					throw std::bad_alloc();
+				}
+				size *= 2;
+			}
+
+			if (size > (std::numeric_limits<size_type>::max)() - sizeof(block_header))
+			{
+				throw std::bad_alloc();
+			}
+
+			block_header* const block = static_cast<block_header*>(::operator new(sizeof(block_header) + size));
+			block->previous = _blocks;
+			block->size = size;
+
+			_blocks = block;
+			_current = reinterpret_cast<unsigned char*>(block + 1);
+			_end = _current + size;
+			_next_block_size = size <= (std::numeric_limits<size_type>::max)() / 2 ? size * 2 : size;
+		}
+
+		block_header* _blocks;
+		unsigned char* _current;
+		unsigned char* _end;
+		size_type _initial_block_size;
+		size_type _next_block_size;
+	};
+
+	// An allocator that allocates from a monotonic_text_arena
+	// Like std::pmr::polymorphic_allocator it never propagates, so strings keep the arena they were created with,
+	// and assigning a string from another arena copies its contents into this arena.
+	template <typename T>
+	class arena_allocator
+	{
+		public:
+		using value_type = T;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+
+		using propagate_on_container_copy_assignment = std::false_type;
+		using propagate_on_container_move_assignment = std::false_type;
+		using propagate_on_container_swap = std::false_type;
+
+		arena_allocator(monotonic_text_arena& arena) noexcept:
+			_arena(&arena)
+		{
+		}
+
+		template <typename U>
+		arena_allocator(const arena_allocator<U>& allocator) noexcept:
+			_arena(allocator.arena())
+		{
+		}
+
+		T* allocate(size_type count)
+		{
+			if (count > (std::numeric_limits<size_type>::max)() / sizeof(T))
+			{
+				throw std::bad_alloc();
+			}
+
+			return static_cast<T*>(_arena->allocate(count * sizeof(T), alignof(T)));
+		}
+
+		void deallocate(T* pointer, size_type count) noexcept
+		{
+			_arena->deallocate(pointer, count * sizeof(T));
+		}
+
+		monotonic_text_arena* arena() const noexcept
+		{
+			return _arena;
+		}
+
+		private:
+		monotonic_text_arena* _arena;
+	};
+
+	template <typename T, typename U>
+	bool operator == (const arena_allocator<T>& left, const arena_allocator<U>& right) noexcept
+	{
+		return left.arena() == right.arena();
+	}
+
+	template <typename T, typename U>
+	bool operator != (const arena_allocator<T>& left, const arena_allocator<U>& right) noexcept
+	{
+		return left.arena() != right.arena();
+	}
+}
+
+#endif
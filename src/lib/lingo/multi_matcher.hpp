@@ -0,0 +1,381 @@
+#ifndef H_LINGO_MULTI_MATCHER
+#define H_LINGO_MULTI_MATCHER
+
+#include <lingo/platform/constexpr.hpp>
+
+#include <lingo/string_view.hpp>
+
+#include <lingo/encoding/decode_back.hpp>
+
+#include <lingo/utility/span.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace lingo
+{
+	// Finds every occurrence of a set of patterns in a single pass over the text
+	// The patterns are compiled into an Aho-Corasick automaton that works directly on the encoded units,
+	// so the text is never decoded. Every unit costs one table lookup, regardless of the number of patterns.
+	template <typename Encoding, typename Page>
+	class multi_matcher
+	{
+		public:
+		using encoding_type = Encoding;
+		using page_type = Page;
+
+		using unit_type = typename encoding_type::unit_type;
+		using point_type = typename encoding_type::point_type;
+
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+
+		using string_view_type = basic_string_view<encoding_type, page_type>;
+
+		struct match_type
+		{
+			// The index of the pattern in the list that the matcher was constructed with
+			size_type pattern_id;
+
+			// The unit offset of the start of the match
+			size_type offset;
+		};
+
+		// Keeps track of the automaton between chunks, so that matches spanning multiple chunks are found
+		class stream_state
+		{
+			public:
+			LINGO_CONSTEXPR11 stream_state() noexcept:
+				_state(0),
+				_offset(0)
+			{
+			}
+
+			// The total amount of units that have been scanned so far
+			LINGO_CONSTEXPR11 size_type offset() const noexcept
+			{
+				return _offset;
+			}
+
+			private:
+			std::uint32_t _state;
+			size_type _offset;
+
+			friend class multi_matcher;
+		};
+
+		private:
+		static_assert(std::is_same<typename page_type::point_type, typename encoding_type::point_type>::value, "page_type::point_type must be the same type as encoding_type::point_type");
+
+		// Unit matches can only be misaligned with points in encodings that cannot find the start of a point from any unit
+		static_assert(encoding::has_decode_back<encoding_type>::value, "multi_matcher requires an encoding that implements decode_one_back");
+
+		using unit_key_type = typename std::make_unsigned<unit_type>::type;
+		using state_type = std::uint32_t;
+
+		// Units below this value are mapped to their class with a direct lookup, larger units use a binary search
+		static LINGO_CONSTEXPR11 const size_type narrow_unit_count = 256;
+
+		// Transitions store the row of the next state, with the highest bit set if the next state reports matches
+		static LINGO_CONSTEXPR11 const state_type report_bit = static_cast<state_type>(1) << 31;
+		static LINGO_CONSTEXPR11 const state_type row_mask = report_bit - 1;
+		static LINGO_CONSTEXPR11 const state_type no_state = static_cast<state_type>(-1);
+
+		public:
+		multi_matcher():
+			multi_matcher(static_cast<const string_view_type*>(nullptr), static_cast<const string_view_type*>(nullptr))
+		{
+		}
+
+		multi_matcher(std::initializer_list<string_view_type> patterns):
+			multi_matcher(patterns.begin(), patterns.end())
+		{
+		}
+
+		// Empty patterns are given an id, but never match
+		template <typename PatternIterator>
+		multi_matcher(PatternIterator first, PatternIterator last):
+			_class_count(1)
+		{
+			std::vector<string_view_type> patterns;
+			for (; first != last; ++first)
+			{
+				patterns.push_back(string_view_type(*first));
+			}
+
+			build_classes(patterns);
+			build_trie(patterns);
+		}
+
+		size_type pattern_count() const noexcept
+		{
+			return _pattern_sizes.size();
+		}
+
+		size_type state_count() const noexcept
+		{
+			return _transitions.size() / _class_count;
+		}
+
+		// Calls callback with a match_type for every occurrence of every pattern in the text
+		// Matches are reported in order of the offset of their end, overlapping matches are all reported
+		template <typename Callback>
+		void for_each_match(string_view_type text, Callback&& callback) const
+		{
+			stream_state state;
+			for_each_match(utility::span<const unit_type>(text.data(), text.size()), state, callback);
+		}
+
+		// Scans the next chunk of a stream, the reported offsets are relative to the start of the stream
+		template <typename Callback>
+		void for_each_match(utility::span<const unit_type> chunk, stream_state& stream, Callback&& callback) const
+		{
+			const unit_type* const units = chunk.data();
+			const size_type size = chunk.size();
+
+			state_type state = stream._state;
+			for (size_type i = 0; i < size; ++i)
+			{
+				state = _transitions[(state & row_mask) + unit_class(units[i])];
+				if ((state & report_bit) != 0)
+				{
+					report(state & row_mask, stream._offset + i + 1, callback);
+				}
+			}
+
+			stream._state = state;
+			stream._offset += size;
+		}
+
+		// Returns true if any pattern occurs in the text
+		bool contains_match(string_view_type text) const noexcept
+		{
+			const unit_type* const units = text.data();
+			const size_type size = text.size();
+
+			state_type state = 0;
+			for (size_type i = 0; i < size; ++i)
+			{
+				state = _transitions[(state & row_mask) + unit_class(units[i])];
+				if ((state & report_bit) != 0)
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		private:
+		state_type unit_class(unit_type unit) const noexcept
+		{
+			const size_type key = static_cast<size_type>(static_cast<unit_key_type>(unit));
+			if (key < narrow_unit_count)
+			{
+				return _narrow_classes[key];
+			}
+
+			const auto wide_unit = std::lower_bound(_wide_units.begin(), _wide_units.end(), static_cast<unit_key_type>(key));
+			if (wide_unit == _wide_units.end() || *wide_unit != key)
+			{
+				return 0;
+			}
+
+			return static_cast<state_type>(wide_unit - _wide_units.begin()) + _first_wide_class;
+		}
+
+		template <typename Callback>
+		void report(state_type row, size_type end, Callback& callback) const
+		{
+			for (state_type state = row / static_cast<state_type>(_class_count); state != no_state; state = _output_links[state])
+			{
+				for (size_type output = _output_offsets[state]; output < _output_offsets[state + 1]; ++output)
+				{
+					const size_type pattern_id = _output_ids[output];
+					callback(match_type{ pattern_id, end - _pattern_sizes[pattern_id] });
+				}
+			}
+		}
+
+		// Every distinct unit that appears in a pattern gets its own class, all other units share class 0
+		// This keeps the rows of the transition table as small as the alphabet of the patterns
+		void build_classes(const std::vector<string_view_type>& patterns)
+		{
+			std::vector<unit_key_type> keys;
+			for (const string_view_type& pattern : patterns)
+			{
+				_pattern_sizes.push_back(pattern.size());
+				for (unit_type unit : pattern)
+				{
+					keys.push_back(static_cast<unit_key_type>(unit));
+				}
+			}
+
+			std::sort(keys.begin(), keys.end());
+			keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+			std::fill(std::begin(_narrow_classes), std::end(_narrow_classes), static_cast<state_type>(0));
+			_first_wide_class = 0;
+			for (size_type i = 0; i < keys.size(); ++i)
+			{
+				const state_type unit_class = static_cast<state_type>(i + 1);
+				if (static_cast<size_type>(keys[i]) < narrow_unit_count)
+				{
+					_narrow_classes[static_cast<size_type>(keys[i])] = unit_class;
+				}
+				else
+				{
+					if (_wide_units.empty())
+					{
+						_first_wide_class = unit_class;
+					}
+					_wide_units.push_back(keys[i]);
+				}
+			}
+
+			_class_count = keys.size() + 1;
+		}
+
+		void build_trie(const std::vector<string_view_type>& patterns)
+		{
+			// Insert the patterns, every state is a row of _class_count transitions
+			std::vector<std::pair<state_type, state_type>> terminals;
+			_transitions.assign(_class_count, no_state);
+			for (size_type pattern_id = 0; pattern_id < patterns.size(); ++pattern_id)
+			{
+				const string_view_type& pattern = patterns[pattern_id];
+				if (pattern.empty())
+				{
+					continue;
+				}
+
+				state_type row = 0;
+				for (unit_type unit : pattern)
+				{
+					const size_type transition = row + unit_class(unit);
+					if (_transitions[transition] == no_state)
+					{
+						if (_transitions.size() + _class_count > row_mask)
+						{
+							throw std::length_error("multi_matcher has too many states");
+						}
+
+						_transitions[transition] = static_cast<state_type>(_transitions.size());
+						_transitions.resize(_transitions.size() + _class_count, no_state);
+					}
+					row = _transitions[transition];
+				}
+
+				terminals.emplace_back(row / static_cast<state_type>(_class_count), static_cast<state_type>(pattern_id));
+			}
+
+			const size_type states = state_count();
+
+			// Flatten the outputs of every state
+			std::stable_sort(terminals.begin(), terminals.end(), [](const std::pair<state_type, state_type>& left, const std::pair<state_type, state_type>& right)
+			{
+				return left.first < right.first;
+			});
+
+			_output_offsets.assign(states + 1, 0);
+			for (const auto& terminal : terminals)
+			{
+				++_output_offsets[terminal.first + 1];
+				_output_ids.push_back(terminal.second);
+			}
+			for (size_type state = 0; state < states; ++state)
+			{
+				_output_offsets[state + 1] += _output_offsets[state];
+			}
+
+			// Breadth first pass to calculate the failure links, and replace missing transitions with the transition of the failure state
+			// The failure state is always less deep, so its row is already complete when it is used
+			std::vector<state_type> failures(states, 0);
+			std::vector<state_type> order;
+			order.reserve(states);
+			_output_links.assign(states, no_state);
+
+			for (size_type unit_class = 0; unit_class < _class_count; ++unit_class)
+			{
+				if (_transitions[unit_class] == no_state)
+				{
+					_transitions[unit_class] = 0;
+				}
+				else
+				{
+					order.push_back(_transitions[unit_class]);
+				}
+			}
+
+			for (size_type i = 0; i < order.size(); ++i)
+			{
+				const state_type row = order[i];
+				const state_type failure = failures[row / _class_count];
+
+				for (size_type unit_class = 0; unit_class < _class_count; ++unit_class)
+				{
+					const state_type next = _transitions[row + unit_class];
+					if (next == no_state)
+					{
+						_transitions[row + unit_class] = _transitions[failure + unit_class];
+					}
+					else
+					{
+						const state_type next_failure = _transitions[failure + unit_class];
+						const state_type next_failure_state = next_failure / static_cast<state_type>(_class_count);
+						failures[next / _class_count] = next_failure;
+						_output_links[next / _class_count] = has_outputs(next_failure_state) ? next_failure_state : _output_links[next_failure_state];
+						order.push_back(next);
+					}
+				}
+			}
+
+			// Mark all transitions into states that report matches
+			for (state_type& transition : _transitions)
+			{
+				const state_type state = transition / static_cast<state_type>(_class_count);
+				if (has_outputs(state) || _output_links[state] != no_state)
+				{
+					transition |= report_bit;
+				}
+			}
+		}
+
+		bool has_outputs(state_type state) const noexcept
+		{
+			return _output_offsets[state] != _output_offsets[state + 1];
+		}
+
+		size_type _class_count;
+		state_type _narrow_classes[narrow_unit_count];
+		std::vector<unit_key_type> _wide_units;
+		state_type _first_wide_class;
+
+		std::vector<state_type> _transitions;
+
+		std::vector<size_type> _pattern_sizes;
+		std::vector<size_type> _output_offsets;
+		std::vector<state_type> _output_ids;
+		std::vector<state_type> _output_links;
+	};
+
+	template <typename Encoding, typename Page>
+	LINGO_CONSTEXPR11 const typename multi_matcher<Encoding, Page>::size_type multi_matcher<Encoding, Page>::narrow_unit_count;
+
+	template <typename Encoding, typename Page>
+	LINGO_CONSTEXPR11 const typename multi_matcher<Encoding, Page>::state_type multi_matcher<Encoding, Page>::report_bit;
+
+	template <typename Encoding, typename Page>
+	LINGO_CONSTEXPR11 const typename multi_matcher<Encoding, Page>::state_type multi_matcher<Encoding, Page>::row_mask;
+
+	template <typename Encoding, typename Page>
+	LINGO_CONSTEXPR11 const typename multi_matcher<Encoding, Page>::state_type multi_matcher<Encoding, Page>::no_state;
+}
+
+#endif
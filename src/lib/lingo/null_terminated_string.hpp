@@ -1,6 +1,8 @@
 #ifndef H_LINGO_NULL_TERMINATED_STRING
 #define H_LINGO_NULL_TERMINATED_STRING
 
+#include <lingo/string_layout.hpp>
+
 #include <lingo/utility/item_traits.hpp>
 #include <lingo/utility/type_traits.hpp>
 
@@ -8,7 +10,7 @@
 
 namespace lingo
 {
-	template <typename Encoding, typename Page, typename Allocator>
+	template <typename Encoding, typename Page, typename Allocator, typename Layout>
 	class basic_string;
 
 	template <typename Encoding, typename Page>
@@ -37,7 +39,7 @@ namespace lingo
 		using difference_type = typename std::allocator_traits<allocator_type>::difference_type;
 
 		private:
-		using string = basic_string<encoding_type, page_type, allocator_type>;
+		using string = basic_string<encoding_type, page_type, allocator_type, string_layout::standard>;
 		using string_view = basic_string_view<encoding_type, page_type>;
 
 		using construct_items = utility::construct_items<value_type>;
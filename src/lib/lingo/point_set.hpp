@@ -0,0 +1,171 @@
+#ifndef H_LINGO_POINT_SET
+#define H_LINGO_POINT_SET
+
+#include <lingo/platform/constexpr.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace lingo
+{
+	// A set of code points, used by the find_first_of family of string functions
+	// ASCII points are stored in a 128 bit bitmap, the rest of the basic multilingual plane in a bitset
+	// that is only allocated once it is needed, and all higher points as a sorted list of ranges.
+	template <typename Point>
+	class point_set
+	{
+		public:
+		using point_type = Point;
+
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+
+		private:
+		using key_type = std::uint_least32_t;
+		using word_type = std::uint64_t;
+		using range_type = std::pair<key_type, key_type>;
+
+		static LINGO_CONSTEXPR11 const key_type ascii_end = 0x80;
+		static LINGO_CONSTEXPR11 const key_type bmp_end = 0x10000;
+		static LINGO_CONSTEXPR11 const size_type word_bits = 64;
+
+		public:
+		point_set() noexcept:
+			_ascii{}
+		{
+		}
+
+		point_set(std::initializer_list<point_type> points):
+			point_set(points.begin(), points.end())
+		{
+		}
+
+		template <typename PointIterator>
+		point_set(PointIterator first, PointIterator last):
+			point_set()
+		{
+			for (; first != last; ++first)
+			{
+				insert(*first);
+			}
+		}
+
+		void insert(point_type point)
+		{
+			insert(point, point);
+		}
+
+		// Inserts all points in the inclusive range [first, last]
+		void insert(point_type first, point_type last)
+		{
+			key_type first_key = to_key(first);
+			const key_type last_key = to_key(last);
+			if (first_key > last_key)
+			{
+				return;
+			}
+
+			for (; first_key <= last_key && first_key < ascii_end; ++first_key)
+			{
+				_ascii[first_key / word_bits] |= word_type(1) << (first_key % word_bits);
+			}
+
+			if (first_key <= last_key && first_key < bmp_end)
+			{
+				if (_bmp.empty())
+				{
+					_bmp.resize(bmp_end / word_bits);
+				}
+
+				for (; first_key <= last_key && first_key < bmp_end; ++first_key)
+				{
+					_bmp[first_key / word_bits] |= word_type(1) << (first_key % word_bits);
+				}
+			}
+
+			if (first_key <= last_key)
+			{
+				insert_range(first_key, last_key);
+			}
+		}
+
+		bool contains(point_type point) const noexcept
+		{
+			const key_type key = to_key(point);
+			if (key < ascii_end)
+			{
+				return ((_ascii[key / word_bits] >> (key % word_bits)) & 1) != 0;
+			}
+			else if (key < bmp_end)
+			{
+				return !_bmp.empty() && ((_bmp[key / word_bits] >> (key % word_bits)) & 1) != 0;
+			}
+			else
+			{
+				const auto range = std::upper_bound(_ranges.begin(), _ranges.end(), key, [](key_type left, const range_type& right)
+				{
+					return left < right.first;
+				});
+				return range != _ranges.begin() && key <= (range - 1)->second;
+			}
+		}
+
+		bool empty() const noexcept
+		{
+			return _ascii[0] == 0 && _ascii[1] == 0 && _bmp.empty() && _ranges.empty();
+		}
+
+		// True if every point in the set is an ASCII point
+		// Strings can be searched for these sets unit by unit, without decoding them, see encoding::has_ascii_units
+		bool is_ascii() const noexcept
+		{
+			return _bmp.empty() && _ranges.empty();
+		}
+
+		private:
+		static LINGO_CONSTEXPR11 key_type to_key(point_type point) noexcept
+		{
+			return static_cast<key_type>(static_cast<typename std::make_unsigned<point_type>::type>(point));
+		}
+
+		// Adds a range above the basic multilingual plane, merging it with any ranges that it overlaps or touches
+		void insert_range(key_type first, key_type last)
+		{
+			auto begin = std::lower_bound(_ranges.begin(), _ranges.end(), first, [](const range_type& left, key_type right)
+			{
+				return left.second < right - 1;
+			});
+
+			auto end = begin;
+			while (end != _ranges.end() && end->first - 1 <= last)
+			{
+				first = (std::min)(first, end->first);
+				last = (std::max)(last, end->second);
+				++end;
+			}
+
+			begin = _ranges.erase(begin, end);
+			_ranges.insert(begin, range_type(first, last));
+		}
+
+		word_type _ascii[2];
+		std::vector<word_type> _bmp;
+		std::vector<range_type> _ranges;
+	};
+
+	template <typename Point>
+	LINGO_CONSTEXPR11 const typename point_set<Point>::key_type point_set<Point>::ascii_end;
+
+	template <typename Point>
+	LINGO_CONSTEXPR11 const typename point_set<Point>::key_type point_set<Point>::bmp_end;
+
+	template <typename Point>
+	LINGO_CONSTEXPR11 const typename point_set<Point>::size_type point_set<Point>::word_bits;
+}
+
+#endif
@@ -0,0 +1,758 @@
+#ifndef H_LINGO_ROPE
+#define H_LINGO_ROPE
+
+#include <lingo/platform/constexpr.hpp>
+
+#include <lingo/string.hpp>
+#include <lingo/string_view.hpp>
+
+#include <lingo/error/error_code.hpp>
+
+#include <lingo/utility/item_traits.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace lingo
+{
+	// A text container for large documents that are edited in many places
+	// The text is stored in immutable chunks at the leaves of a balanced binary tree, and every node caches the amount of units and points below it.
+	// Inserting, erasing, taking a substring and finding a point by index take O(log n) time, and copies share all of their chunks.
+	// Chunks never end in the middle of a point, so every chunk is a valid string on its own. Iterating over a rope yields its chunks as views.
+	// Positions are unit offsets like in basic_string, and must lie on a point boundary.
+	// Units that cannot be decoded are counted as one point each.
+	template <typename Encoding, typename Page>
+	class basic_rope
+	{
+		public:
+		using encoding_type = Encoding;
+		using page_type = Page;
+
+		using unit_type = typename encoding_type::unit_type;
+		using point_type = typename encoding_type::point_type;
+
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+
+		using string_type = basic_string<encoding_type, page_type>;
+		using string_view_type = basic_string_view<encoding_type, page_type>;
+
+		class chunk_iterator;
+		using iterator = chunk_iterator;
+		using const_iterator = chunk_iterator;
+
+		static LINGO_CONSTEXPR11 const size_type npos = static_cast<size_type>(-1);
+
+		// The maximum amount of units in a single chunk
+		// Small neighbouring chunks are merged, so a rope that is edited one point at a time does not end up with a chunk per point
+		static LINGO_CONSTEXPR11 const size_type max_chunk_size = 512;
+
+		private:
+		static_assert(max_chunk_size >= encoding_type::max_units, "A chunk must be able to hold the largest point");
+
+		using mismatch_items = utility::mismatch_items<unit_type>;
+
+		struct node;
+		using node_pointer = std::shared_ptr<const node>;
+
+		// Leaves own a chunk, branches own two subtrees that are never empty
+		struct node
+		{
+			node(string_type&& units, size_type points):
+				chunk(std::move(units)),
+				units(chunk.size()),
+				points(points),
+				height(1)
+			{
+			}
+
+			node(node_pointer left, node_pointer right):
+				left(std::move(left)),
+				right(std::move(right)),
+				units(this->left->units + this->right->units),
+				points(this->left->points + this->right->points),
+				height((std::max)(this->left->height, this->right->height) + 1)
+			{
+			}
+
+			bool is_leaf() const noexcept
+			{
+				return left == nullptr;
+			}
+
+			node_pointer left;
+			node_pointer right;
+			string_type chunk;
+			size_type units;
+			size_type points;
+			size_type height;
+		};
+
+		public:
+		// Iterates over the chunks of a rope from front to back
+		class chunk_iterator
+		{
+			public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = string_view_type;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const value_type*;
+			using reference = value_type;
+
+			chunk_iterator() noexcept:
+				_current(nullptr)
+			{
+			}
+
+			value_type operator * () const noexcept
+			{
+				return _current->chunk.view();
+			}
+
+			chunk_iterator& operator ++ ()
+			{
+				if (_pending.empty())
+				{
+					_current = nullptr;
+				}
+				else
+				{
+					const node* const next = _pending.back();
+					_pending.pop_back();
+					descend(next);
+				}
+				return *this;
+			}
+
+			chunk_iterator operator ++ (int)
+			{
+				chunk_iterator prev(*this);
+				operator++();
+				return prev;
+			}
+
+			bool operator == (const chunk_iterator& right) const noexcept
+			{
+				return _current == right._current;
+			}
+
+			bool operator != (const chunk_iterator& right) const noexcept
+			{
+				return _current != right._current;
+			}
+
+			private:
+			explicit chunk_iterator(const node* root):
+				_current(nullptr)
+			{
+				if (root != nullptr)
+				{
+					_pending.reserve(root->height);
+					descend(root);
+				}
+			}
+
+			// Moves to the leftmost leaf, remembering the right subtrees that are visited after it
+			void descend(const node* current)
+			{
+				while (!current->is_leaf())
+				{
+					_pending.push_back(current->right.get());
+					current = current->left.get();
+				}
+				_current = current;
+			}
+
+			const node* _current;
+			std::vector<const node*> _pending;
+
+			friend class basic_rope;
+		};
+
+		basic_rope() noexcept = default;
+
+		basic_rope(string_view_type str):
+			_root(build(str))
+		{
+		}
+
+		basic_rope(const basic_rope&) = default;
+		basic_rope(basic_rope&&) noexcept = default;
+
+		basic_rope& operator = (const basic_rope&) = default;
+		basic_rope& operator = (basic_rope&&) noexcept = default;
+
+		basic_rope& operator = (string_view_type str)
+		{
+			_root = build(str);
+			return *this;
+		}
+
+		// The amount of units
+		size_type size() const noexcept
+		{
+			return _root != nullptr ? _root->units : 0;
+		}
+
+		// The amount of points
+		size_type point_count() const noexcept
+		{
+			return _root != nullptr ? _root->points : 0;
+		}
+
+		bool empty() const noexcept
+		{
+			return _root == nullptr;
+		}
+
+		unit_type at(size_type pos) const
+		{
+			if (pos >= size())
+			{
+				throw std::out_of_range("Index out of range");
+			}
+
+			return (*this)[pos];
+		}
+
+		unit_type operator [] (size_type pos) const noexcept
+		{
+			const node* current = _root.get();
+			while (!current->is_leaf())
+			{
+				if (pos < current->left->units)
+				{
+					current = current->left.get();
+				}
+				else
+				{
+					pos -= current->left->units;
+					current = current->right.get();
+				}
+			}
+			return current->chunk[pos];
+		}
+
+		// Returns the index of the point that starts at unit offset pos, or the amount of points if pos is the size of the rope
+		size_type point_index(size_type pos) const noexcept
+		{
+			if (pos >= size())
+			{
+				return point_count();
+			}
+
+			size_type index = 0;
+			const node* current = _root.get();
+			while (!current->is_leaf())
+			{
+				if (pos < current->left->units)
+				{
+					current = current->left.get();
+				}
+				else
+				{
+					pos -= current->left->units;
+					index += current->left->points;
+					current = current->right.get();
+				}
+			}
+
+			const unit_type* const units = current->chunk.data();
+			for (size_type offset = 0; offset < pos; ++index)
+			{
+				offset += point_size(units + offset, current->units - offset);
+			}
+			return index;
+		}
+
+		// Returns the unit offset at which the point with the given index starts, or the size of the rope if index is the amount of points
+		size_type unit_index(size_type index) const
+		{
+			if (index > point_count())
+			{
+				throw std::out_of_range("index > point_count()");
+			}
+			if (index == point_count())
+			{
+				return size();
+			}
+
+			size_type pos = 0;
+			const node* current = _root.get();
+			while (!current->is_leaf())
+			{
+				if (index < current->left->points)
+				{
+					current = current->left.get();
+				}
+				else
+				{
+					index -= current->left->points;
+					pos += current->left->units;
+					current = current->right.get();
+				}
+			}
+
+			const unit_type* const units = current->chunk.data();
+			size_type offset = 0;
+			for (; index > 0; --index)
+			{
+				offset += point_size(units + offset, current->units - offset);
+			}
+			return pos + offset;
+		}
+
+		const_iterator begin() const
+		{
+			return const_iterator(_root.get());
+		}
+
+		const_iterator cbegin() const
+		{
+			return begin();
+		}
+
+		const_iterator end() const noexcept
+		{
+			return const_iterator();
+		}
+
+		const_iterator cend() const noexcept
+		{
+			return end();
+		}
+
+		void clear() noexcept
+		{
+			_root.reset();
+		}
+
+		void insert(size_type pos, string_view_type str)
+		{
+			insert_tree(pos, build(str));
+		}
+
+		void insert(size_type pos, const basic_rope& str)
+		{
+			insert_tree(pos, str._root);
+		}
+
+		void erase(size_type pos = 0, size_type count = npos)
+		{
+			if (pos > size())
+			{
+				throw std::out_of_range("pos > size()");
+			}
+
+			count = (std::min)(count, size() - pos);
+			node_pointer front, middle, back;
+			split(_root, pos + count, middle, back);
+			split(middle, pos, front, middle);
+			_root = join(front, back);
+		}
+
+		void append(string_view_type str)
+		{
+			_root = join(_root, build(str));
+		}
+
+		void append(const basic_rope& str)
+		{
+			_root = join(_root, str._root);
+		}
+
+		basic_rope& operator += (string_view_type str)
+		{
+			append(str);
+			return *this;
+		}
+
+		basic_rope& operator += (const basic_rope& str)
+		{
+			append(str);
+			return *this;
+		}
+
+		// Shares the chunks of this rope instead of copying them, only the chunks at both ends are split
+		basic_rope substr(size_type pos = 0, size_type count = npos) const
+		{
+			if (pos > size())
+			{
+				throw std::out_of_range("pos > size()");
+			}
+
+			count = (std::min)(count, size() - pos);
+			node_pointer front, middle, back;
+			split(_root, pos + count, middle, back);
+			split(middle, pos, front, middle);
+
+			basic_rope result;
+			result._root = std::move(middle);
+			return result;
+		}
+
+		// Copies all chunks into a single string
+		string_type str() const
+		{
+			string_type result;
+			result.reserve(size());
+			for (const string_view_type chunk : *this)
+			{
+				result.append(chunk);
+			}
+			return result;
+		}
+
+		bool equals(string_view_type str) const
+		{
+			if (str.size() != size())
+			{
+				return false;
+			}
+
+			size_type offset = 0;
+			for (const string_view_type chunk : *this)
+			{
+				if (mismatch_items{}(chunk.data(), str.data() + offset, chunk.size()) != chunk.size())
+				{
+					return false;
+				}
+				offset += chunk.size();
+			}
+			return true;
+		}
+
+		bool equals(const basic_rope& str) const
+		{
+			if (str.size() != size())
+			{
+				return false;
+			}
+			if (str._root == _root)
+			{
+				return true;
+			}
+
+			// The chunks of both ropes can end at different offsets, so compare them piece by piece
+			const_iterator left = begin();
+			const_iterator right = str.begin();
+			size_type left_offset = 0;
+			size_type right_offset = 0;
+			while (left != end())
+			{
+				const string_view_type left_chunk = *left;
+				const string_view_type right_chunk = *right;
+				const size_type count = (std::min)(left_chunk.size() - left_offset, right_chunk.size() - right_offset);
+				if (mismatch_items{}(left_chunk.data() + left_offset, right_chunk.data() + right_offset, count) != count)
+				{
+					return false;
+				}
+
+				left_offset += count;
+				right_offset += count;
+				if (left_offset == left_chunk.size())
+				{
+					++left;
+					left_offset = 0;
+				}
+				if (right_offset == right_chunk.size())
+				{
+					++right;
+					right_offset = 0;
+				}
+			}
+			return true;
+		}
+
+		private:
+		// The amount of units in the point at the front of the buffer, undecodable units are skipped one at a time
+		static size_type point_size(const unit_type* data, size_type size) noexcept
+		{
+			point_type point{};
+			typename encoding_type::decode_state_type state{};
+			const auto result = encoding_type::decode_one(
+				typename encoding_type::decode_source_type(data, size),
+				typename encoding_type::decode_destination_type(&point, 1),
+				state, true);
+
+			const size_type units_read = size - result.source.size();
+			return result.error == error::error_code::success && units_read > 0 ? units_read : 1;
+		}
+
+		static size_type count_points(string_view_type str) noexcept
+		{
+			size_type points = 0;
+			for (size_type offset = 0; offset < str.size(); ++points)
+			{
+				offset += point_size(str.data() + offset, str.size() - offset);
+			}
+			return points;
+		}
+
+		static node_pointer make_leaf(string_view_type str)
+		{
+			string_type chunk(str);
+			const size_type points = count_points(str);
+			return std::make_shared<const node>(std::move(chunk), points);
+		}
+
+		static node_pointer make_branch(node_pointer left, node_pointer right)
+		{
+			return std::make_shared<const node>(std::move(left), std::move(right));
+		}
+
+		static size_type height(const node_pointer& tree) noexcept
+		{
+			return tree != nullptr ? tree->height : 0;
+		}
+
+		// Cuts the string into chunks at point boundaries and builds a perfectly balanced tree out of them
+		static node_pointer build(string_view_type str)
+		{
+			std::vector<node_pointer> leaves;
+			leaves.reserve(str.size() / max_chunk_size + 1);
+
+			size_type first = 0;
+			size_type offset = 0;
+			while (offset < str.size())
+			{
+				const size_type units = point_size(str.data() + offset, str.size() - offset);
+				if (offset + units - first > max_chunk_size)
+				{
+					leaves.push_back(make_leaf(string_view_type(str.data() + first, offset - first, false)));
+					first = offset;
+				}
+				offset += units;
+			}
+			if (offset > first)
+			{
+				leaves.push_back(make_leaf(string_view_type(str.data() + first, offset - first, false)));
+			}
+
+			return build(leaves, 0, leaves.size());
+		}
+
+		static node_pointer build(const std::vector<node_pointer>& leaves, size_type first, size_type last)
+		{
+			if (first == last)
+			{
+				return nullptr;
+			}
+			if (last - first == 1)
+			{
+				return leaves[first];
+			}
+
+			const size_type middle = first + (last - first) / 2;
+			return make_branch(build(leaves, first, middle), build(leaves, middle, last));
+		}
+
+		// Creates a branch of two trees whose heights differ by at most 2, rotating them if they differ by 2
+		static node_pointer balance(node_pointer left, node_pointer right)
+		{
+			if (height(left) > height(right) + 1)
+			{
+				if (height(left->left) >= height(left->right))
+				{
+					return make_branch(left->left, make_branch(left->right, std::move(right)));
+				}
+				else
+				{
+					return make_branch(make_branch(left->left, left->right->left), make_branch(left->right->right, std::move(right)));
+				}
+			}
+			else if (height(right) > height(left) + 1)
+			{
+				if (height(right->right) >= height(right->left))
+				{
+					return make_branch(make_branch(std::move(left), right->left), right->right);
+				}
+				else
+				{
+					return make_branch(make_branch(std::move(left), right->left->left), make_branch(right->left->right, right->right));
+				}
+			}
+			else
+			{
+				return make_branch(std::move(left), std::move(right));
+			}
+		}
+
+		// Concatenates two trees, walking down the side of the taller tree until the heights match
+		// This takes time proportional to the difference in height
+		static node_pointer join(const node_pointer& left, const node_pointer& right)
+		{
+			if (left == nullptr)
+			{
+				return right;
+			}
+			if (right == nullptr)
+			{
+				return left;
+			}
+
+			if (left->is_leaf() && right->is_leaf() && left->units + right->units <= max_chunk_size)
+			{
+				string_type chunk;
+				chunk.reserve(left->units + right->units);
+				chunk.append(left->chunk.view());
+				chunk.append(right->chunk.view());
+
+				// Invalid sequences that were split between the leaves could decode as a single point once merged,
+				// which would change the point count and the point boundaries, so those leaves are kept apart
+				const size_type points = count_points(chunk.view());
+				if (points == left->points + right->points)
+				{
+					return std::make_shared<const node>(std::move(chunk), points);
+				}
+			}
+
+			if (left->height > right->height + 1)
+			{
+				return balance(left->left, join(left->right, right));
+			}
+			else if (right->height > left->height + 1)
+			{
+				return balance(join(left, right->left), right->right);
+			}
+			else
+			{
+				return make_branch(left, right);
+			}
+		}
+
+		// Splits a tree into the units before pos and the units from pos onwards
+		// The tree is taken by value, so that it can be one of the outputs
+		static void split(node_pointer tree, size_type pos, node_pointer& left, node_pointer& right)
+		{
+			if (tree == nullptr || pos == 0)
+			{
+				left = nullptr;
+				right = tree;
+				return;
+			}
+			if (pos >= tree->units)
+			{
+				left = tree;
+				right = nullptr;
+				return;
+			}
+
+			if (tree->is_leaf())
+			{
+				const string_view_type chunk = tree->chunk.view();
+				size_type offset = 0;
+				while (offset < pos)
+				{
+					offset += point_size(chunk.data() + offset, chunk.size() - offset);
+				}
+				if (offset != pos)
+				{
+					throw std::invalid_argument("pos is not on a point boundary");
+				}
+
+				left = make_leaf(string_view_type(chunk.data(), pos, false));
+				right = make_leaf(string_view_type(chunk.data() + pos, chunk.size() - pos, false));
+			}
+			else if (pos < tree->left->units)
+			{
+				node_pointer middle;
+				split(tree->left, pos, left, middle);
+				right = join(middle, tree->right);
+			}
+			else
+			{
+				node_pointer middle;
+				split(tree->right, pos - tree->left->units, middle, right);
+				left = join(tree->left, middle);
+			}
+		}
+
+		void insert_tree(size_type pos, const node_pointer& tree)
+		{
+			if (pos > size())
+			{
+				throw std::out_of_range("pos > size()");
+			}
+
+			node_pointer front, back;
+			split(_root, pos, front, back);
+			_root = join(join(front, tree), back);
+		}
+
+		node_pointer _root;
+	};
+
+	template <typename Encoding, typename Page>
+	LINGO_CONSTEXPR11 const typename basic_rope<Encoding, Page>::size_type basic_rope<Encoding, Page>::npos;
+	template <typename Encoding, typename Page>
+	LINGO_CONSTEXPR11 const typename basic_rope<Encoding, Page>::size_type basic_rope<Encoding, Page>::max_chunk_size;
+
+	template <typename Encoding, typename Page>
+	bool operator == (const basic_rope<Encoding, Page>& left, const basic_rope<Encoding, Page>& right)
+	{
+		return left.equals(right);
+	}
+
+	template <typename Encoding, typename Page>
+	bool operator != (const basic_rope<Encoding, Page>& left, const basic_rope<Encoding, Page>& right)
+	{
+		return !left.equals(right);
+	}
+
+	template <typename Encoding, typename Page>
+	bool operator == (const basic_rope<Encoding, Page>& left, basic_string_view<Encoding, Page> right)
+	{
+		return left.equals(right);
+	}
+
+	template <typename Encoding, typename Page>
+	bool operator != (const basic_rope<Encoding, Page>& left, basic_string_view<Encoding, Page> right)
+	{
+		return !left.equals(right);
+	}
+
+	template <typename Encoding, typename Page>
+	bool operator == (basic_string_view<Encoding, Page> left, const basic_rope<Encoding, Page>& right)
+	{
+		return right.equals(left);
+	}
+
+	template <typename Encoding, typename Page>
+	bool operator != (basic_string_view<Encoding, Page> left, const basic_rope<Encoding, Page>& right)
+	{
+		return !right.equals(left);
+	}
+
+	// Fixed page typedefs
+	template <typename Encoding>
+	using basic_unicode_rope = basic_rope<Encoding, page::unicode_default>;
+
+	// Fixed encoding typedefs
+	template <typename Unit>
+	using basic_utf8_rope = basic_unicode_rope<encoding::utf8<Unit, char32_t>>;
+	template <typename Unit>
+	using basic_utf16_rope = basic_unicode_rope<encoding::utf16<Unit, char32_t>>;
+	template <typename Unit>
+	using basic_utf32_rope = basic_unicode_rope<encoding::utf32<Unit, char32_t>>;
+
+	// Fully specialized typedefs
+	#ifdef __cpp_char8_t
+	using utf8_rope = basic_utf8_rope<char8_t>;
+	#else
+	using utf8_rope = basic_utf8_rope<char>;
+	#endif
+
+	using utf16_rope = basic_utf16_rope<char16_t>;
+	using utf32_rope = basic_utf32_rope<char32_t>;
+
+	// Default rope typedef
+	using rope = utf8_rope;
+}
+
+#endif
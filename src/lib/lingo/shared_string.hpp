@@ -0,0 +1,491 @@
+#ifndef H_LINGO_SHARED_STRING
+#define H_LINGO_SHARED_STRING
+
+#include <lingo/platform/constexpr.hpp>
+
+#include <lingo/string.hpp>
+#include <lingo/string_view.hpp>
+
+#include <lingo/utility/item_traits.hpp>
+#include <lingo/utility/pointer_iterator.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace lingo
+{
+	// An immutable string that shares its units between copies
+	// Copies and substrings only increment an atomic reference count, so the string can be handed to many threads and queues.
+	// Strings created from a view store the reference count and the units in a single allocation.
+	// Strings created by moving a basic_string keep the buffer of that string, and give it back when they are moved out with str() while they are the only owner.
+	template <typename Encoding, typename Page, typename Allocator = internal::default_allocator<Encoding>>
+	class basic_shared_string
+	{
+		public:
+		using encoding_type = Encoding;
+		using page_type = Page;
+		using allocator_type = Allocator;
+
+		using unit_type = typename encoding_type::unit_type;
+		using point_type = typename encoding_type::point_type;
+
+		using value_type = unit_type;
+		using reference = const value_type&;
+		using const_reference = const value_type&;
+		using pointer = const value_type*;
+		using const_pointer = const value_type*;
+
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+
+		struct iterator_tag;
+		using iterator = utility::pointer_iterator<const value_type, iterator_tag>;
+		using const_iterator = iterator;
+		using reverse_iterator = std::reverse_iterator<iterator>;
+		using const_reverse_iterator = reverse_iterator;
+
+		using string_type = basic_string<encoding_type, page_type, allocator_type>;
+		using string_view_type = basic_string_view<encoding_type, page_type>;
+
+		static LINGO_CONSTEXPR11 const size_type npos = static_cast<size_type>(-1);
+		static LINGO_CONSTEXPR11 const unit_type null_terminator = unit_type{};
+
+		private:
+		static_assert(std::is_same<unit_type, typename allocator_type::value_type>::value, "allocator_type::value_type must be the same type as basic_shared_string::unit_type");
+
+		using copy_items = utility::copy_items<value_type>;
+
+		// The units either follow the block in the same allocation, or are owned by the string inside the block
+		struct block
+		{
+			block(const allocator_type& allocator, size_type allocated_blocks):
+				references(1),
+				allocated_blocks(allocated_blocks),
+				string(allocator)
+			{
+			}
+
+			block(string_type&& str, size_type allocated_blocks):
+				references(1),
+				allocated_blocks(allocated_blocks),
+				string(std::move(str))
+			{
+			}
+
+			std::atomic<std::size_t> references;
+			size_type allocated_blocks;
+			string_type string;
+		};
+
+		using block_allocator_type = typename std::allocator_traits<allocator_type>::template rebind_alloc<block>;
+		using block_allocator_traits = std::allocator_traits<block_allocator_type>;
+
+		public:
+		basic_shared_string() noexcept:
+			_block(nullptr),
+			_data(&null_terminator),
+			_size(0)
+		{
+		}
+
+		basic_shared_string(string_view_type str, const allocator_type& allocator = allocator_type()):
+			basic_shared_string()
+		{
+			if (!str.empty())
+			{
+				// Allocate the block with enough room behind it for the units and the null terminator
+				const size_type unit_blocks = ((str.size() + 1) * sizeof(unit_type) + sizeof(block) - 1) / sizeof(block);
+				_block = create_block(allocator, unit_blocks + 1, allocator);
+
+				unit_type* const units = reinterpret_cast<unit_type*>(_block + 1);
+				copy_items{}(units, str.data(), str.size());
+				copy_items{}(units + str.size(), &null_terminator, 1);
+
+				_data = units;
+				_size = str.size();
+			}
+		}
+
+		explicit basic_shared_string(const string_type& str):
+			basic_shared_string(str.view(), str.get_allocator())
+		{
+		}
+
+		// Takes over the buffer of the string without copying the units
+		basic_shared_string(string_type&& str):
+			basic_shared_string()
+		{
+			if (!str.empty())
+			{
+				_block = create_block(str.get_allocator(), 1, std::move(str));
+
+				_data = _block->string.data();
+				_size = _block->string.size();
+			}
+		}
+
+		basic_shared_string(const basic_shared_string& str) noexcept:
+			_block(str._block),
+			_data(str._data),
+			_size(str._size)
+		{
+			if (_block != nullptr)
+			{
+				_block->references.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+
+		basic_shared_string(basic_shared_string&& str) noexcept:
+			_block(str._block),
+			_data(str._data),
+			_size(str._size)
+		{
+			str.reset();
+		}
+
+		~basic_shared_string() noexcept
+		{
+			release();
+		}
+
+		basic_shared_string& operator = (const basic_shared_string& str) noexcept
+		{
+			basic_shared_string(str).swap(*this);
+			return *this;
+		}
+
+		basic_shared_string& operator = (basic_shared_string&& str) noexcept
+		{
+			basic_shared_string(std::move(str)).swap(*this);
+			return *this;
+		}
+
+		const_reference operator [] (size_type index) const noexcept
+		{
+			return _data[index];
+		}
+
+		const_reference at(size_type index) const
+		{
+			if (index >= _size)
+			{
+				throw std::out_of_range("index >= size()");
+			}
+			return _data[index];
+		}
+
+		const_reference front() const noexcept
+		{
+			return _data[0];
+		}
+
+		const_reference back() const noexcept
+		{
+			return _data[_size - 1];
+		}
+
+		const_pointer data() const noexcept
+		{
+			return _data;
+		}
+
+		size_type size() const noexcept
+		{
+			return _size;
+		}
+
+		bool empty() const noexcept
+		{
+			return _size == 0;
+		}
+
+		// The amount of shared strings that share the units with this one, or 0 for empty strings
+		size_type use_count() const noexcept
+		{
+			return _block != nullptr ? _block->references.load(std::memory_order_relaxed) : 0;
+		}
+
+		const_iterator begin() const noexcept
+		{
+			return const_iterator(_data);
+		}
+
+		const_iterator cbegin() const noexcept
+		{
+			return begin();
+		}
+
+		const_iterator end() const noexcept
+		{
+			return const_iterator(_data + _size);
+		}
+
+		const_iterator cend() const noexcept
+		{
+			return end();
+		}
+
+		const_reverse_iterator rbegin() const noexcept
+		{
+			return const_reverse_iterator(end());
+		}
+
+		const_reverse_iterator rend() const noexcept
+		{
+			return const_reverse_iterator(begin());
+		}
+
+		// Shares the units of this string instead of copying them
+		basic_shared_string substr(size_type pos = 0, size_type count = npos) const
+		{
+			if (pos > _size)
+			{
+				throw std::out_of_range("pos > size()");
+			}
+
+			basic_shared_string result(*this);
+			result._data += pos;
+			result._size = (std::min)(count, _size - pos);
+			return result;
+		}
+
+		int compare(string_view_type str) const noexcept(noexcept(std::declval<string_view_type&>().compare(str)))
+		{
+			return view().compare(str);
+		}
+
+		// The unit after the end of a substring is always readable, so substrings that happen to end in front of a null unit are null terminated as well
+		string_view_type view() const noexcept
+		{
+			return string_view_type(_data, _size, _data[_size] == null_terminator);
+		}
+
+		operator string_view_type() const noexcept
+		{
+			return view();
+		}
+
+		string_type str() const &
+		{
+			return _block != nullptr ? string_type(view(), _block->string.get_allocator()) : string_type();
+		}
+
+		// Moves the buffer back into a string if this is the only owner of a buffer that came from a string, and copies otherwise
+		string_type str() &&
+		{
+			if (_block != nullptr &&
+				_block->references.load(std::memory_order_acquire) == 1 &&
+				!_block->string.empty() &&
+				_data == _block->string.data() &&
+				_size == _block->string.size())
+			{
+				string_type result(std::move(_block->string));
+				release();
+				reset();
+				return result;
+			}
+
+			return static_cast<const basic_shared_string&>(*this).str();
+		}
+
+		void swap(basic_shared_string& str) noexcept
+		{
+			std::swap(_block, str._block);
+			std::swap(_data, str._data);
+			std::swap(_size, str._size);
+		}
+
+		private:
+		template <typename Argument>
+		static block* create_block(const allocator_type& allocator, size_type allocated_blocks, Argument&& argument)
+		{
+			block_allocator_type block_allocator(allocator);
+			block* const result = block_allocator_traits::allocate(block_allocator, allocated_blocks);
+			try
+			{
+				::new (static_cast<void*>(result)) block(std::forward<Argument>(argument), allocated_blocks);
+			}
+			catch (...)
+			{
+				block_allocator_traits::deallocate(block_allocator, result, allocated_blocks);
+				throw;
+			}
+			return result;
+		}
+
+		void reset() noexcept
+		{
+			_block = nullptr;
+			_data = &null_terminator;
+			_size = 0;
+		}
+
+		void release() noexcept
+		{
+			if (_block != nullptr && _block->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				block_allocator_type block_allocator(_block->string.get_allocator());
+				const size_type allocated_blocks = _block->allocated_blocks;
+				_block->~block();
+				block_allocator_traits::deallocate(block_allocator, _block, allocated_blocks);
+			}
+		}
+
+		block* _block;
+		const_pointer _data;
+		size_type _size;
+	};
+
+	template <typename Encoding, typename Page, typename Allocator>
+	LINGO_CONSTEXPR11 const typename basic_shared_string<Encoding, Page, Allocator>::size_type basic_shared_string<Encoding, Page, Allocator>::npos;
+	template <typename Encoding, typename Page, typename Allocator>
+	LINGO_CONSTEXPR11 const typename basic_shared_string<Encoding, Page, Allocator>::unit_type basic_shared_string<Encoding, Page, Allocator>::null_terminator;
+
+	template <typename Encoding, typename Page, typename Allocator>
+	void swap(basic_shared_string<Encoding, Page, Allocator>& left, basic_shared_string<Encoding, Page, Allocator>& right) noexcept
+	{
+		left.swap(right);
+	}
+
+	template <typename Encoding, typename Page, typename Allocator>
+	bool operator == (const basic_shared_string<Encoding, Page, Allocator>& left, const basic_shared_string<Encoding, Page, Allocator>& right) noexcept(noexcept(left.compare(right)))
+	{
+		return left.view() == right.view();
+	}
+
+	template <typename Encoding, typename Page, typename Allocator>
+	bool operator != (const basic_shared_string<Encoding, Page, Allocator>& left, const basic_shared_string<Encoding, Page, Allocator>& right) noexcept(noexcept(left.compare(right)))
+	{
+		return left.view() != right.view();
+	}
+
+	template <typename Encoding, typename Page, typename Allocator>
+	bool operator < (const basic_shared_string<Encoding, Page, Allocator>& left, const basic_shared_string<Encoding, Page, Allocator>& right) noexcept(noexcept(left.compare(right)))
+	{
+		return left.compare(right) < 0;
+	}
+
+	template <typename Encoding, typename Page, typename Allocator>
+	bool operator > (const basic_shared_string<Encoding, Page, Allocator>& left, const basic_shared_string<Encoding, Page, Allocator>& right) noexcept(noexcept(left.compare(right)))
+	{
+		return left.compare(right) > 0;
+	}
+
+	template <typename Encoding, typename Page, typename Allocator>
+	bool operator <= (const basic_shared_string<Encoding, Page, Allocator>& left, const basic_shared_string<Encoding, Page, Allocator>& right) noexcept(noexcept(left.compare(right)))
+	{
+		return left.compare(right) <= 0;
+	}
+
+	template <typename Encoding, typename Page, typename Allocator>
+	bool operator >= (const basic_shared_string<Encoding, Page, Allocator>& left, const basic_shared_string<Encoding, Page, Allocator>& right) noexcept(noexcept(left.compare(right)))
+	{
+		return left.compare(right) >= 0;
+	}
+
+	template <typename Encoding, typename Page, typename Allocator>
+	bool operator == (const basic_shared_string<Encoding, Page, Allocator>& left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
+	{
+		return left.view() == right;
+	}
+
+	template <typename Encoding, typename Page, typename Allocator>
+	bool operator != (const basic_shared_string<Encoding, Page, Allocator>& left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
+	{
+		return left.view() != right;
+	}
+
+	template <typename Encoding, typename Page, typename Allocator>
+	bool operator < (const basic_shared_string<Encoding, Page, Allocator>& left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
+	{
+		return left.compare(right) < 0;
+	}
+
+	template <typename Encoding, typename Page, typename Allocator>
+	bool operator > (const basic_shared_string<Encoding, Page, Allocator>& left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
+	{
+		return left.compare(right) > 0;
+	}
+
+	template <typename Encoding, typename Page, typename Allocator>
+	bool operator <= (const basic_shared_string<Encoding, Page, Allocator>& left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
+	{
+		return left.compare(right) <= 0;
+	}
+
+	template <typename Encoding, typename Page, typename Allocator>
+	bool operator >= (const basic_shared_string<Encoding, Page, Allocator>& left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
+	{
+		return left.compare(right) >= 0;
+	}
+
+	template <typename Encoding, typename Page, typename Allocator>
+	bool operator == (basic_string_view<Encoding, Page> left, const basic_shared_string<Encoding, Page, Allocator>& right) noexcept(noexcept(right.compare(left)))
+	{
+		return left == right.view();
+	}
+
+	template <typename Encoding, typename Page, typename Allocator>
+	bool operator != (basic_string_view<Encoding, Page> left, const basic_shared_string<Encoding, Page, Allocator>& right) noexcept(noexcept(right.compare(left)))
+	{
+		return left != right.view();
+	}
+
+	template <typename Encoding, typename Page, typename Allocator>
+	bool operator < (basic_string_view<Encoding, Page> left, const basic_shared_string<Encoding, Page, Allocator>& right) noexcept(noexcept(right.compare(left)))
+	{
+		return right.compare(left) > 0;
+	}
+
+	template <typename Encoding, typename Page, typename Allocator>
+	bool operator > (basic_string_view<Encoding, Page> left, const basic_shared_string<Encoding, Page, Allocator>& right) noexcept(noexcept(right.compare(left)))
+	{
+		return right.compare(left) < 0;
+	}
+
+	template <typename Encoding, typename Page, typename Allocator>
+	bool operator <= (basic_string_view<Encoding, Page> left, const basic_shared_string<Encoding, Page, Allocator>& right) noexcept(noexcept(right.compare(left)))
+	{
+		return right.compare(left) >= 0;
+	}
+
+	template <typename Encoding, typename Page, typename Allocator>
+	bool operator >= (basic_string_view<Encoding, Page> left, const basic_shared_string<Encoding, Page, Allocator>& right) noexcept(noexcept(right.compare(left)))
+	{
+		return right.compare(left) <= 0;
+	}
+
+	// Fixed page typedefs
+	template <typename Encoding, typename Allocator = internal::default_allocator<Encoding>>
+	using basic_unicode_shared_string = basic_shared_string<Encoding, page::unicode_default, Allocator>;
+
+	// Fixed encoding typedefs
+	template <typename Unit, typename Allocator = internal::default_allocator<encoding::utf8<Unit, char32_t>>>
+	using basic_utf8_shared_string = basic_unicode_shared_string<encoding::utf8<Unit, char32_t>, Allocator>;
+	template <typename Unit, typename Allocator = internal::default_allocator<encoding::utf16<Unit, char32_t>>>
+	using basic_utf16_shared_string = basic_unicode_shared_string<encoding::utf16<Unit, char32_t>, Allocator>;
+	template <typename Unit, typename Allocator = internal::default_allocator<encoding::utf32<Unit, char32_t>>>
+	using basic_utf32_shared_string = basic_unicode_shared_string<encoding::utf32<Unit, char32_t>, Allocator>;
+
+	// Fully specialized typedefs
+	#ifdef __cpp_char8_t
+	using utf8_shared_string = basic_utf8_shared_string<char8_t>;
+	#else
+	using utf8_shared_string = basic_utf8_shared_string<char>;
+	#endif
+
+	using utf16_shared_string = basic_utf16_shared_string<char16_t>;
+	using utf32_shared_string = basic_utf32_shared_string<char32_t>;
+
+	// Default shared string typedef
+	using shared_string = utf8_shared_string;
+}
+
+#endif
@@ -4,13 +4,19 @@
 #include <lingo/platform/constexpr.hpp>
 
 #include <lingo/null_terminated_string.hpp>
+#include <lingo/point_set.hpp>
 #include <lingo/string_converter.hpp>
 #include <lingo/string_storage.hpp>
 #include <lingo/string_view.hpp>
+#include <lingo/validated_string_view.hpp>
 
+#include <lingo/encoding/decode_back.hpp>
 #include <lingo/encoding/execution.hpp>
 #include <lingo/encoding/point_iterator.hpp>
 
+#include <lingo/error/exception.hpp>
+#include <lingo/error/handler_tag.hpp>
+
 #include <lingo/page/execution.hpp>
 #include <lingo/page/point_mapper.hpp>
 
@@ -32,13 +38,14 @@
 
 namespace lingo
 {
-	template <typename Encoding, typename Page, typename Allocator = internal::default_allocator<Encoding>>
+	template <typename Encoding, typename Page, typename Allocator = internal::default_allocator<Encoding>, typename Layout = string_layout::standard>
 	class basic_string
 	{
 		public:
 		using encoding_type = Encoding;
 		using page_type = Page;
 		using allocator_type = Allocator;
+		using layout_type = Layout;
 
 		using unit_type = typename encoding_type::unit_type;
 		using point_type = typename encoding_type::point_type;
@@ -65,7 +72,7 @@ namespace lingo
 		static_assert(std::is_same<typename page_type::point_type, typename encoding_type::point_type>::value, "page_type::point_type must be the same type as encoding_type::point_type");
 		static_assert(std::is_same<typename allocator_type::value_type, typename encoding_type::unit_type>::value, "allocator_type::value_type must be the same type as encoding_type::unit_type");
 
-		using storage_type = basic_string_storage<value_type, allocator_type>;
+		using storage_type = basic_string_storage<value_type, allocator_type, layout_type>;
 		using basic_string_view = lingo::basic_string_view<encoding_type, page_type>;
 
 		using construct_items = utility::construct_items<value_type>;
@@ -155,18 +162,37 @@ namespace lingo
 
 		template <typename SourceEncoding, typename SourcePage>
 		explicit basic_string(lingo::basic_string_view<SourceEncoding, SourcePage> basic_string_view, const allocator_type& allocator = allocator_type()):
-			basic_string(string_converter<SourceEncoding, SourcePage, encoding_type, page_type>().template convert<allocator_type>(basic_string_view, allocator))
+			basic_string(string_converter<SourceEncoding, SourcePage, encoding_type, page_type>().template convert<allocator_type, layout_type>(basic_string_view, allocator))
+		{
+		}
+
+		template <typename SourceEncoding, typename SourcePage, typename SourceAllocator, typename SourceLayout>
+		explicit basic_string(basic_string<SourceEncoding, SourcePage, SourceAllocator, SourceLayout> string, const allocator_type& allocator = allocator_type()):
+			basic_string(string_converter<SourceEncoding, SourcePage, encoding_type, page_type>().template convert<allocator_type, layout_type>(string, allocator))
+		{
+		}
+
+		template <typename SourceEncoding, typename SourcePage,
+			typename std::enable_if<!std::is_same<SourceEncoding, encoding_type>::value || !std::is_same<SourcePage, page_type>::value, int>::type = 0>
+		explicit basic_string(basic_validated_string_view<SourceEncoding, SourcePage> basic_string_view, const allocator_type& allocator = allocator_type()):
+			basic_string(string_converter<SourceEncoding, SourcePage, encoding_type, page_type>().template convert<allocator_type, layout_type>(basic_string_view, allocator))
 		{
 		}
 
-		template <typename SourceEncoding, typename SourcePage, typename SourceAllocator>
-		explicit basic_string(basic_string<SourceEncoding, SourcePage, SourceAllocator> string, const allocator_type& allocator = allocator_type()):
-			basic_string(string_converter<SourceEncoding, SourcePage, encoding_type, page_type>().template convert<allocator_type>(string, allocator))
+		template <typename SourceEncoding, typename SourcePage, template <typename, typename> class ErrorHandler>
+		basic_string(lingo::basic_string_view<SourceEncoding, SourcePage> basic_string_view, error::handler_tag<ErrorHandler>, const allocator_type& allocator = allocator_type()):
+			basic_string(string_converter<SourceEncoding, SourcePage, encoding_type, page_type, ErrorHandler>().template convert<allocator_type, layout_type>(basic_string_view, allocator))
+		{
+		}
+
+		template <typename SourceEncoding, typename SourcePage, typename SourceAllocator, typename SourceLayout, template <typename, typename> class ErrorHandler>
+		basic_string(const basic_string<SourceEncoding, SourcePage, SourceAllocator, SourceLayout>& string, error::handler_tag<ErrorHandler>, const allocator_type& allocator = allocator_type()):
+			basic_string(string_converter<SourceEncoding, SourcePage, encoding_type, page_type, ErrorHandler>().template convert<allocator_type, layout_type>(string, allocator))
 		{
 		}
 
 		basic_string(const basic_string& str):
-			basic_string(str, allocator_type())
+			basic_string(str, std::allocator_traits<allocator_type>::select_on_container_copy_construction(str.get_allocator()))
 		{
 		}
 
@@ -196,7 +222,7 @@ namespace lingo
 		}
 
 		basic_string(basic_string&& str):
-			basic_string(std::move(str), allocator_type())
+			basic_string(std::move(str), str.get_allocator())
 		{
 		}
 
@@ -341,9 +367,10 @@ namespace lingo
 			return _storage.capacity();
 		}
 
+		// Reduces the capacity to what the growth policy allocates for the current size, and moves the string back into the small string buffer if it fits
 		void shrink_to_fit()
 		{
-			// TODO: actually shrink
+			_storage.shrink_to_fit();
 		}
 
 		bool empty() const noexcept
@@ -363,10 +390,7 @@ namespace lingo
 
 			if (new_size > original_size)
 			{
-				for (size_type i = original_size; i < new_size; ++i)
-				{
-					copy_items{}(data() + i, &null_terminator, 1);
-				}
+				std::uninitialized_fill_n(data() + original_size, new_size - original_size, null_terminator);
 			}
 			else
 			{
@@ -377,6 +401,32 @@ namespace lingo
 			_storage.set_size(new_size);
 		}
 
+		// Resizes the string to count units, and lets operation write the contents directly into the buffer
+		// operation is called as operation(data(), count) and returns the final size of the string, which can be at most count
+		// The first min(size(), count) units keep their value, the units after that are left uninitialized
+		template <typename Operation>
+		void resize_and_overwrite(size_type count, Operation operation)
+		{
+			const size_type kept_size = (std::min)(size(), count);
+			_storage.grow_uninitialized(count, kept_size);
+
+			size_type new_size = kept_size;
+			try
+			{
+				new_size = static_cast<size_type>(operation(data(), count));
+			}
+			catch (...)
+			{
+				copy_items{}(data() + kept_size, &null_terminator, 1);
+				_storage.set_size(kept_size);
+				throw;
+			}
+
+			assert(new_size <= count);
+			copy_items{}(data() + new_size, &null_terminator, 1);
+			_storage.set_size(new_size);
+		}
+
 		void reserve(size_type reserved_size)
 		{
 			const size_type original_size = size();
@@ -389,6 +439,46 @@ namespace lingo
 			resize(0);
 		}
 
+		// Swaps the contents, and the allocators if they propagate on swap
+		void swap(basic_string& str) noexcept
+		{
+			_storage.swap(str._storage);
+		}
+
+		// Replaces the contents with a buffer that was allocated with allocator.allocate(capacity + 1), without copying the units
+		// The first size units of the buffer become the string, and the null terminator is written behind them, so size <= capacity is required.
+		// If the allocator cannot be propagated and does not compare equal to get_allocator(), the units are copied and the buffer is deallocated instead.
+		// Not available for string_layout::compact, which stores the capacity in front of its own allocations.
+		void adopt(pointer units, size_type size, size_type capacity, const allocator_type& allocator)
+		{
+			_storage.adopt(units, size, capacity, allocator);
+		}
+
+		void adopt(pointer units, size_type size, size_type capacity)
+		{
+			_storage.adopt(units, size, capacity, get_allocator());
+		}
+
+		// A buffer handed out by release()
+		// It holds capacity + 1 units, of which the first size units are the string followed by a null terminator.
+		// It has to be deallocated with get_allocator().deallocate(data, capacity + 1), or handed back to a string with adopt().
+		struct buffer_type
+		{
+			pointer data;
+			size_type size;
+			size_type capacity;
+		};
+
+		// Hands the buffer over to the caller and leaves the string empty
+		// Strings that fit in the small string buffer are copied into a new allocation first, so the result is always allocated by get_allocator().
+		// Not available for string_layout::compact, which stores the capacity in front of its own allocations.
+		buffer_type release()
+		{
+			const size_type original_size = size();
+			const auto alloc = _storage.release_allocation();
+			return buffer_type{ alloc.data, original_size, alloc.size - 1 };
+		}
+
 		void assign(size_type count, point_type point)
 		{
 			// Encode the point into units
@@ -402,7 +492,7 @@ namespace lingo
 
 			// Allocate memory
 			const size_t point_size = result.destination.data() - encoded_point;
-			const size_type destination_size = point_size * count;
+			const size_type destination_size = points_size(0, point_size, count);
 			_storage.grow_discard(destination_size);
 			const pointer destination_data = data();
 
@@ -423,7 +513,7 @@ namespace lingo
 		{
 			if (this != &str)
 			{
-				assign(str.operator lingo::basic_string_view<Encoding, Page>());
+				_storage = str._storage;
 			}
 		}
 
@@ -553,7 +643,7 @@ namespace lingo
 			// Allocate memory
 			const size_t point_size = result.destination.data() - encoded_point;
 			const size_type original_size = size();
-			const size_type destination_size = point_size * count + original_size;
+			const size_type destination_size = original_size + points_size(original_size, point_size, count);
 			_storage.grow_append(destination_size);
 			const pointer destination_data = data();
 
@@ -674,39 +764,146 @@ namespace lingo
 			append(basic_string_view(str), pos, count);
 		}
 
-		void insert(size_type index, basic_string_view string, size_type count) noexcept(noexcept(std::declval<storage_type&>().grow(std::declval<size_t>())))
+		basic_string& insert(size_type index, size_type count, point_type point)
+		{
+			return replace(index, 0, count, point);
+		}
+
+		basic_string& insert(size_type index, basic_string_view str)
+		{
+			return replace(index, 0, str);
+		}
+
+		basic_string& insert(size_type index, basic_string_view str, size_type pos, size_type count = npos)
+		{
+			return replace(index, 0, str, pos, count);
+		}
+
+		iterator insert(const_iterator position, point_type point)
+		{
+			return insert(position, 1, point);
+		}
+
+		iterator insert(const_iterator position, size_type count, point_type point)
+		{
+			const size_type index = static_cast<size_type>(position - cbegin());
+			insert(index, count, point);
+			return begin() + static_cast<difference_type>(index);
+		}
+
+		basic_string& erase(size_type index = 0, size_type count = npos)
 		{
-			// Make sure that the index is valid
-			assert(index <= size());
+			if (index > size())
+			{
+				throw std::out_of_range("index > size()");
+			}
+
+			_storage.grow_move(index, (std::min)(count, size() - index), 0);
+			return *this;
+		}
+
+		// Erases a single unit
+		iterator erase(const_iterator position)
+		{
+			return erase(position, position + 1);
+		}
+
+		iterator erase(const_iterator first, const_iterator last)
+		{
+			const size_type index = static_cast<size_type>(first - cbegin());
+			_storage.grow_move(index, static_cast<size_type>(last - first), 0);
+			return begin() + static_cast<difference_type>(index);
+		}
 
-			// Empty strings and counts of 0 can be ignored
-			if (string.size() == 0 || count == 0)
+		// Replaces count units at pos with str
+		// If the string does not grow, the units behind the replaced units are moved in place. Otherwise at most one allocation is made.
+		basic_string& replace(size_type pos, size_type count, basic_string_view str)
+		{
+			if (pos > size())
 			{
-				return;
+				throw std::out_of_range("pos > size()");
 			}
 
-			size_type old_size = size();
-			size_type new_size = size() + string.size() * count;
+			replace_units(pos, (std::min)(count, size() - pos), str.data(), str.size());
+			return *this;
+		}
+
+		basic_string& replace(size_type pos, size_type count, basic_string_view str, size_type str_pos, size_type str_count = npos)
+		{
+			if (str_pos > str.size())
+			{
+				throw std::out_of_range("str_pos > str.size()");
+			}
 
-			// Allocate enough room 
-			_storage.grow_append(new_size); // TODO: grow_move
+			return replace(pos, count, basic_string_view(str.data() + str_pos, (std::min)(str_count, str.size() - str_pos), false));
+		}
 
-			// Destruct old data (null terminator was destructed by grow_append)
-			for (size_type i = index; i < old_size; ++i)
+		basic_string& replace(size_type pos, size_type count, size_type point_count, point_type point)
+		{
+			if (pos > size())
 			{
-				destruct_items{}(_storage.data() + new_size, 1);
+				throw std::out_of_range("pos > size()");
 			}
 
-			// Copy string count times
-			for (size_type i = 0; i < count; ++i)
+			// Encode the point into units
+			unit_type encoded_point[encoding_type::max_units];
+			const size_type point_size = encode_point(point, encoded_point);
+
+			// Make room for the points and fill it
+			count = (std::min)(count, size() - pos);
+			_storage.grow_move(pos, count, points_size(size() - count, point_size, point_count));
+			const pointer destination_data = data() + pos;
+			for (size_type i = 0; i < point_count; ++i)
 			{
-				copy_items{}(_storage.data() + index + string.size() * i, string.data(), string.size());
+				copy_items{}(destination_data + i * point_size, encoded_point, point_size);
 			}
 
-			// Construct new null terminator
-			copy_items{}(_storage.data() + new_size, &null_terminator, 1);
+			return *this;
+		}
 
-			// Update size
+		basic_string& replace(const_iterator first, const_iterator last, basic_string_view str)
+		{
+			return replace(static_cast<size_type>(first - cbegin()), static_cast<size_type>(last - first), str);
+		}
+
+		// Appends a single point
+		// If there is room for the largest point, it is encoded straight into the buffer
+		void push_back(point_type point)
+		{
+			const size_type original_size = size();
+			if (capacity() - original_size < encoding_type::max_units)
+			{
+				append(1, point);
+				return;
+			}
+
+			const pointer destination_data = data() + original_size;
+			const auto result = encoding_type::encode_one(utility::span<const point_type>(&point, 1), utility::span<unit_type>(destination_data, encoding_type::max_units));
+			if (result.error != error::error_code::success)
+			{
+				copy_items{}(destination_data, &null_terminator, 1);
+				throw error::exception(result.error);
+			}
+
+			const size_type point_size = static_cast<size_type>(result.destination.data() - destination_data);
+			copy_items{}(destination_data + point_size, &null_terminator, 1);
+			_storage.set_size(original_size + point_size);
+		}
+
+		// Removes the last point
+		// If the last units do not form a valid point, only the last unit is removed
+		template <typename _ = int, typename std::enable_if<encoding::has_decode_back<encoding_type>::value, _>::type = 0>
+		void pop_back() noexcept
+		{
+			assert(!empty());
+
+			const size_type original_size = size();
+			point_type point{};
+			const auto result = encoding_type::decode_one_back(utility::span<const unit_type>(data(), original_size), utility::span<point_type>(&point, 1));
+			const size_type new_size = result.error == error::error_code::success ? result.source.size() : original_size - 1;
+
+			destruct_items{}(data() + new_size, original_size - new_size + 1);
+			copy_items{}(data() + new_size, &null_terminator, 1);
 			_storage.set_size(new_size);
 		}
 
@@ -720,8 +917,8 @@ namespace lingo
 			return view().copy(dest, count, pos);
 		}
 
-		template <typename OtherAllocator>
-		basic_string& operator += (const basic_string<Encoding, Page, OtherAllocator>& other)
+		template <typename OtherAllocator, typename OtherLayout>
+		basic_string& operator += (const basic_string<Encoding, Page, OtherAllocator, OtherLayout>& other)
 		{
 			// We can't simply call the basic_string_view version here
 			// If &other == this, the data pointer in the string view might become invalid when growing the capacity
@@ -737,7 +934,7 @@ namespace lingo
 
 		basic_string& operator += (point_type other)
 		{
-			append(1, other);
+			push_back(other);
 			return *this;
 		}
 		
@@ -789,13 +986,13 @@ namespace lingo
 			return basic_string_view(data(), size(), true);
 		}
 
-		template <typename RightAllocator>
-		LINGO_CONSTEXPR14 int compare(const basic_string<encoding_type, page_type, RightAllocator>& str) const noexcept(noexcept(std::declval<const basic_string&>().compare(str.view())))
+		template <typename RightAllocator, typename RightLayout>
+		LINGO_CONSTEXPR14 int compare(const basic_string<encoding_type, page_type, RightAllocator, RightLayout>& str) const noexcept(noexcept(std::declval<const basic_string&>().compare(str.view())))
 		{
 			return compare(str.view());
 		}
 
-		LINGO_CONSTEXPR14 int compare(basic_string_view str) const
+		LINGO_CONSTEXPR14 int compare(basic_string_view str) const noexcept(noexcept(std::declval<const basic_string_view&>().compare(str)))
 		{
 			return view().compare(str);
 		}
@@ -814,6 +1011,20 @@ namespace lingo
 		}
 		#endif
 
+		template <typename OtherEncoding, typename OtherPage, typename OtherAllocator, typename OtherLayout, typename std::enable_if<
+			!std::is_same<OtherEncoding, encoding_type>::value || !std::is_same<OtherPage, page_type>::value, int>::type = 0>
+		int compare(const basic_string<OtherEncoding, OtherPage, OtherAllocator, OtherLayout>& str) const
+		{
+			return view().compare(str.view());
+		}
+
+		template <typename OtherEncoding, typename OtherPage, typename std::enable_if<
+			!std::is_same<OtherEncoding, encoding_type>::value || !std::is_same<OtherPage, page_type>::value, int>::type = 0>
+		int compare(lingo::basic_string_view<OtherEncoding, OtherPage> str) const
+		{
+			return view().compare(str);
+		}
+
 		LINGO_CONSTEXPR14 size_type find(const basic_string& str) const noexcept
 		{
 			return find(str.view());
@@ -864,7 +1075,7 @@ namespace lingo
 
 		LINGO_CONSTEXPR14 size_type find(basic_string_view str) const noexcept
 		{
-			return find(str);
+			return find(str, 0);
 		}
 
 		LINGO_CONSTEXPR14 size_type find(basic_string_view str, size_type pos) const noexcept
@@ -901,7 +1112,7 @@ namespace lingo
 
 		LINGO_CONSTEXPR14 size_type rfind(const basic_string& str, size_type pos) const noexcept
 		{
-			return find(str.view(), pos);
+			return rfind(str.view(), pos);
 		}
 
 		template <typename _ = int, typename std::enable_if<is_execution_set, _>::type = 0>
@@ -944,7 +1155,7 @@ namespace lingo
 
 		LINGO_CONSTEXPR14 size_type rfind(basic_string_view str) const noexcept
 		{
-			return rfind(str);
+			return rfind(str, npos);
 		}
 
 		LINGO_CONSTEXPR14 size_type rfind(basic_string_view str, size_type pos) const noexcept
@@ -974,6 +1185,79 @@ namespace lingo
 			return rfind(basic_string_view(str), pos);
 		}
 
+		template <typename OtherEncoding, typename OtherPage, typename std::enable_if<
+			!std::is_same<OtherEncoding, encoding_type>::value || !std::is_same<OtherPage, page_type>::value, int>::type = 0>
+		size_type find(lingo::basic_string_view<OtherEncoding, OtherPage> str, size_type pos = 0) const
+		{
+			return view().find(str, pos);
+		}
+
+		template <typename OtherEncoding, typename OtherPage, typename OtherAllocator, typename OtherLayout, typename std::enable_if<
+			!std::is_same<OtherEncoding, encoding_type>::value || !std::is_same<OtherPage, page_type>::value, int>::type = 0>
+		size_type find(const basic_string<OtherEncoding, OtherPage, OtherAllocator, OtherLayout>& str, size_type pos = 0) const
+		{
+			return view().find(str.view(), pos);
+		}
+
+		template <typename OtherEncoding, typename OtherPage, typename std::enable_if<
+			!std::is_same<OtherEncoding, encoding_type>::value || !std::is_same<OtherPage, page_type>::value, int>::type = 0>
+		size_type rfind(lingo::basic_string_view<OtherEncoding, OtherPage> str, size_type pos = npos) const
+		{
+			return view().rfind(str, pos);
+		}
+
+		template <typename OtherEncoding, typename OtherPage, typename OtherAllocator, typename OtherLayout, typename std::enable_if<
+			!std::is_same<OtherEncoding, encoding_type>::value || !std::is_same<OtherPage, page_type>::value, int>::type = 0>
+		size_type rfind(const basic_string<OtherEncoding, OtherPage, OtherAllocator, OtherLayout>& str, size_type pos = npos) const
+		{
+			return view().rfind(str.view(), pos);
+		}
+
+		size_type point_index(size_type pos) const noexcept
+		{
+			return view().point_index(pos);
+		}
+
+		size_type find_first_of(const point_set<point_type>& points, size_type pos = 0) const noexcept
+		{
+			return view().find_first_of(points, pos);
+		}
+
+		size_type find_first_of(basic_string_view str, size_type pos = 0) const
+		{
+			return view().find_first_of(str, pos);
+		}
+
+		size_type find_first_not_of(const point_set<point_type>& points, size_type pos = 0) const noexcept
+		{
+			return view().find_first_not_of(points, pos);
+		}
+
+		size_type find_first_not_of(basic_string_view str, size_type pos = 0) const
+		{
+			return view().find_first_not_of(str, pos);
+		}
+
+		size_type find_last_of(const point_set<point_type>& points, size_type pos = npos) const noexcept
+		{
+			return view().find_last_of(points, pos);
+		}
+
+		size_type find_last_of(basic_string_view str, size_type pos = npos) const
+		{
+			return view().find_last_of(str, pos);
+		}
+
+		size_type find_last_not_of(const point_set<point_type>& points, size_type pos = npos) const noexcept
+		{
+			return view().find_last_not_of(points, pos);
+		}
+
+		size_type find_last_not_of(basic_string_view str, size_type pos = npos) const
+		{
+			return view().find_last_not_of(str, pos);
+		}
+
 		LINGO_CONSTEXPR14 bool starts_with(basic_string_view str) const noexcept
 		{
 			return view().starts_with(str);
@@ -1023,80 +1307,117 @@ namespace lingo
 		#endif
 
 		private:
+		// Encodes a single point and returns the amount of units it takes
+		static size_type encode_point(point_type point, unit_type (&units)[encoding_type::max_units])
+		{
+			const auto result = encoding_type::encode_one(utility::span<const point_type>(&point, 1), units);
+			if (result.error != error::error_code::success)
+			{
+				throw error::exception(result.error);
+			}
+
+			return static_cast<size_type>(result.destination.data() - units);
+		}
+
+		// The amount of units taken up by count points of point_size units, throws std::length_error if they do not fit behind original_size units
+		size_type points_size(size_type original_size, size_type point_size, size_type count) const
+		{
+			if (count > 0 && point_size > (max_size() - original_size) / count)
+			{
+				throw std::length_error("basic_string is too large");
+			}
+
+			return point_size * count;
+		}
+
+		void replace_units(size_type pos, size_type count, const_pointer source, size_type source_size)
+		{
+			// The source could move while the units are shifted, so copy it out of this string first
+			if (source_size > 0 && source >= data() && source <= data() + size())
+			{
+				const basic_string copy(basic_string_view(source, source_size, false), get_allocator());
+				replace_units(pos, count, copy.data(), source_size);
+				return;
+			}
+
+			_storage.grow_move(pos, count, source_size);
+			copy_items{}(data() + pos, source, source_size);
+		}
+
 		storage_type _storage;
 	};
 
-	template <typename Encoding, typename Page, typename Allocator>
-	LINGO_CONSTEXPR11 typename basic_string<Encoding, Page, Allocator>::size_type basic_string<Encoding, Page, Allocator>::npos;
-	template <typename Encoding, typename Page, typename Allocator>
-	LINGO_CONSTEXPR11 typename basic_string<Encoding, Page, Allocator>::unit_type basic_string<Encoding, Page, Allocator>::null_terminator;
-	template <typename Encoding, typename Page, typename Allocator>
-	LINGO_CONSTEXPR11 bool basic_string<Encoding, Page, Allocator>::is_execution_set;
+	template <typename Encoding, typename Page, typename Allocator, typename Layout>
+	LINGO_CONSTEXPR11 typename basic_string<Encoding, Page, Allocator, Layout>::size_type basic_string<Encoding, Page, Allocator, Layout>::npos;
+	template <typename Encoding, typename Page, typename Allocator, typename Layout>
+	LINGO_CONSTEXPR11 typename basic_string<Encoding, Page, Allocator, Layout>::unit_type basic_string<Encoding, Page, Allocator, Layout>::null_terminator;
+	template <typename Encoding, typename Page, typename Allocator, typename Layout>
+	LINGO_CONSTEXPR11 bool basic_string<Encoding, Page, Allocator, Layout>::is_execution_set;
 
-	template <typename Encoding, typename Page, typename LeftAllocator, typename RightAllocator, typename ResultAllocator = LeftAllocator>
-	basic_string<Encoding, Page, ResultAllocator> operator + (basic_string<Encoding, Page, LeftAllocator> left, basic_string<Encoding, Page, RightAllocator> right)
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout, typename RightAllocator, typename RightLayout, typename ResultAllocator = LeftAllocator, typename ResultLayout = LeftLayout>
+	basic_string<Encoding, Page, ResultAllocator, ResultLayout> operator + (basic_string<Encoding, Page, LeftAllocator, LeftLayout> left, basic_string<Encoding, Page, RightAllocator, RightLayout> right)
 	{
-		return operator+<Encoding, Page, ResultAllocator>(
+		return operator+<Encoding, Page, ResultAllocator, ResultLayout>(
 			left.operator lingo::basic_string_view<Encoding, Page>(),
 			right.operator lingo::basic_string_view<Encoding, Page>());
 	}
 
-	template <typename Encoding, typename Page, typename LeftAllocator, typename ResultAllocator = LeftAllocator>
-	basic_string<Encoding, Page, ResultAllocator> operator + (basic_string<Encoding, Page, LeftAllocator> left, basic_string_view<Encoding, Page> right)
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout, typename ResultAllocator = LeftAllocator, typename ResultLayout = LeftLayout>
+	basic_string<Encoding, Page, ResultAllocator, ResultLayout> operator + (basic_string<Encoding, Page, LeftAllocator, LeftLayout> left, basic_string_view<Encoding, Page> right)
 	{
-		return operator+<Encoding, Page, ResultAllocator>(
+		return operator+<Encoding, Page, ResultAllocator, ResultLayout>(
 			left.operator lingo::basic_string_view<Encoding, Page>(),
 			right);
 	}
 
-	template <typename Encoding, typename Page, typename RightAllocator, typename ResultAllocator = RightAllocator>
-	basic_string<Encoding, Page, ResultAllocator> operator + (basic_string_view<Encoding, Page> left, basic_string<Encoding, Page, RightAllocator> right)
+	template <typename Encoding, typename Page, typename RightAllocator, typename RightLayout, typename ResultAllocator = RightAllocator, typename ResultLayout = RightLayout>
+	basic_string<Encoding, Page, ResultAllocator, ResultLayout> operator + (basic_string_view<Encoding, Page> left, basic_string<Encoding, Page, RightAllocator, RightLayout> right)
 	{
-		return operator+<Encoding, Page, ResultAllocator>(
+		return operator+<Encoding, Page, ResultAllocator, ResultLayout>(
 			left,
 			right.operator lingo::basic_string_view<Encoding, Page>());
 	}
 
-	template <typename Encoding, typename Page, typename ResultAllocator = internal::default_allocator<Encoding>>
-	basic_string<Encoding, Page, ResultAllocator> operator + (const basic_string_view<Encoding, Page>& left, const basic_string_view<Encoding, Page>& right)
+	template <typename Encoding, typename Page, typename ResultAllocator = internal::default_allocator<Encoding>, typename ResultLayout = string_layout::standard>
+	basic_string<Encoding, Page, ResultAllocator, ResultLayout> operator + (const basic_string_view<Encoding, Page>& left, const basic_string_view<Encoding, Page>& right)
 	{
-		basic_string<Encoding, Page, ResultAllocator> result;
+		basic_string<Encoding, Page, ResultAllocator, ResultLayout> result;
 		result.reserve(left.size() + right.size());
 		result.append(left);
 		result.append(right);
 		return result;
 	}
 
-	template <typename Encoding, typename Page, typename LeftAllocator, typename ResultAllocator = LeftAllocator>
-	basic_string<Encoding, Page, ResultAllocator> operator + (const basic_string<Encoding, Page, LeftAllocator>& left, typename Encoding::point_type right)
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout, typename ResultAllocator = LeftAllocator, typename ResultLayout = LeftLayout>
+	basic_string<Encoding, Page, ResultAllocator, ResultLayout> operator + (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, typename Encoding::point_type right)
 	{
-		basic_string<Encoding, Page, ResultAllocator> result;
+		basic_string<Encoding, Page, ResultAllocator, ResultLayout> result;
 		result.reserve(left.size() + Encoding::max_units);
 		result = left;
 		result.append(1, right);
 		return result;
 	}
 
-	template <typename Encoding, typename Page, typename RightAllocator, typename ResultAllocator = RightAllocator>
-	basic_string<Encoding, Page, ResultAllocator> operator + (typename Encoding::point_type left, const basic_string<Encoding, Page, RightAllocator>& right)
+	template <typename Encoding, typename Page, typename RightAllocator, typename RightLayout, typename ResultAllocator = RightAllocator, typename ResultLayout = RightLayout>
+	basic_string<Encoding, Page, ResultAllocator, ResultLayout> operator + (typename Encoding::point_type left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right)
 	{
-		basic_string<Encoding, Page, ResultAllocator> result;
+		basic_string<Encoding, Page, ResultAllocator, ResultLayout> result;
 		result.reserve(right.size() + Encoding::max_units);
 		result.append(1, left);
 		result.append(right);
 		return result;
 	}
 
-	template <typename Encoding, typename Page, typename LeftAllocator, typename ResultAllocator = LeftAllocator,
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout, typename ResultAllocator = LeftAllocator, typename ResultLayout = LeftLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value, int>::type = 0>
-	basic_string<Encoding, Page, ResultAllocator> operator + (const basic_string<Encoding, Page, LeftAllocator>& left, const typename Encoding::unit_type* right)
+	basic_string<Encoding, Page, ResultAllocator, ResultLayout> operator + (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, const typename Encoding::unit_type* right)
 	{
 		return left + basic_string_view<Encoding, Page>(right);
 	}
 
-	template <typename Encoding, typename Page, typename RightAllocator, typename ResultAllocator = RightAllocator,
+	template <typename Encoding, typename Page, typename RightAllocator, typename RightLayout, typename ResultAllocator = RightAllocator, typename ResultLayout = RightLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value, int>::type = 0>
-	basic_string<Encoding, Page, ResultAllocator> operator + (const typename Encoding::unit_type* left, const basic_string<Encoding, Page, RightAllocator>& right)
+	basic_string<Encoding, Page, ResultAllocator, ResultLayout> operator + (const typename Encoding::unit_type* left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right)
 	{
 		return basic_string_view<Encoding, Page>(left) + right;
 	}
@@ -1116,16 +1437,16 @@ namespace lingo
 	}
 	
 	#ifndef LINGO_DISABLE_CHAR_COMPATIBILITY
-	template <typename Encoding, typename Page, typename LeftAllocator, typename ResultAllocator = LeftAllocator,
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout, typename ResultAllocator = LeftAllocator, typename ResultLayout = LeftLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value && lingo::utility::is_char_compatible<Encoding, Page>::value, int>::type = 0>
-		basic_string<Encoding, Page, ResultAllocator> operator + (const basic_string<Encoding, Page, LeftAllocator>& left, const char* right)
+		basic_string<Encoding, Page, ResultAllocator, ResultLayout> operator + (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, const char* right)
 	{
 		return left + reinterpret_cast<const typename Encoding::unit_type*>(right);
 	}
 
-	template <typename Encoding, typename Page, typename RightAllocator, typename ResultAllocator = RightAllocator,
+	template <typename Encoding, typename Page, typename RightAllocator, typename RightLayout, typename ResultAllocator = RightAllocator, typename ResultLayout = RightLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value && lingo::utility::is_char_compatible<Encoding, Page>::value, int>::type = 0>
-		basic_string<Encoding, Page, ResultAllocator> operator + (const char* left, const basic_string<Encoding, Page, RightAllocator>& right)
+		basic_string<Encoding, Page, ResultAllocator, ResultLayout> operator + (const char* left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right)
 	{
 		return reinterpret_cast<const typename Encoding::unit_type*>(left) + right;
 	}
@@ -1145,294 +1466,342 @@ namespace lingo
 	}
 	#endif
 
-	template <typename Encoding, typename Page, typename LeftAllocator, typename RightAllocator>
-	bool operator == (const basic_string<Encoding, Page, LeftAllocator>& left, const basic_string<Encoding, Page, RightAllocator>& right) noexcept(noexcept(left.compare(right)))
+	template <typename Encoding, typename Page, typename Allocator, typename Layout>
+	void swap(basic_string<Encoding, Page, Allocator, Layout>& left, basic_string<Encoding, Page, Allocator, Layout>& right) noexcept
 	{
-		return left.compare(right) == 0;
+		left.swap(right);
 	}
 
-	template <typename Encoding, typename Page, typename LeftAllocator, typename RightAllocator>
-	bool operator != (const basic_string<Encoding, Page, LeftAllocator>& left, const basic_string<Encoding, Page, RightAllocator>& right) noexcept(noexcept(left.compare(right)))
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout, typename RightAllocator, typename RightLayout>
+	bool operator == (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right) noexcept(noexcept(left.compare(right)))
 	{
-		return left.compare(right) != 0;
+		return left.view() == right.view();
 	}
 
-	template <typename Encoding, typename Page, typename LeftAllocator, typename RightAllocator>
-	bool operator < (const basic_string<Encoding, Page, LeftAllocator>& left, const basic_string<Encoding, Page, RightAllocator>& right) noexcept(noexcept(left.compare(right)))
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout, typename RightAllocator, typename RightLayout>
+	bool operator != (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right) noexcept(noexcept(left.compare(right)))
+	{
+		return left.view() != right.view();
+	}
+
+	template <typename LeftEncoding, typename LeftPage, typename LeftAllocator, typename LeftLayout, typename RightEncoding, typename RightPage, typename RightAllocator, typename RightLayout, typename std::enable_if<
+		!std::is_same<LeftEncoding, RightEncoding>::value || !std::is_same<LeftPage, RightPage>::value, int>::type = 0>
+	bool operator == (const basic_string<LeftEncoding, LeftPage, LeftAllocator, LeftLayout>& left, const basic_string<RightEncoding, RightPage, RightAllocator, RightLayout>& right)
+	{
+		return left.view() == right.view();
+	}
+
+	template <typename LeftEncoding, typename LeftPage, typename LeftAllocator, typename LeftLayout, typename RightEncoding, typename RightPage, typename RightAllocator, typename RightLayout, typename std::enable_if<
+		!std::is_same<LeftEncoding, RightEncoding>::value || !std::is_same<LeftPage, RightPage>::value, int>::type = 0>
+	bool operator != (const basic_string<LeftEncoding, LeftPage, LeftAllocator, LeftLayout>& left, const basic_string<RightEncoding, RightPage, RightAllocator, RightLayout>& right)
+	{
+		return left.view() != right.view();
+	}
+
+	template <typename LeftEncoding, typename LeftPage, typename LeftAllocator, typename LeftLayout, typename RightEncoding, typename RightPage, typename std::enable_if<
+		!std::is_same<LeftEncoding, RightEncoding>::value || !std::is_same<LeftPage, RightPage>::value, int>::type = 0>
+	bool operator == (const basic_string<LeftEncoding, LeftPage, LeftAllocator, LeftLayout>& left, basic_string_view<RightEncoding, RightPage> right)
+	{
+		return left.view() == right;
+	}
+
+	template <typename LeftEncoding, typename LeftPage, typename LeftAllocator, typename LeftLayout, typename RightEncoding, typename RightPage, typename std::enable_if<
+		!std::is_same<LeftEncoding, RightEncoding>::value || !std::is_same<LeftPage, RightPage>::value, int>::type = 0>
+	bool operator != (const basic_string<LeftEncoding, LeftPage, LeftAllocator, LeftLayout>& left, basic_string_view<RightEncoding, RightPage> right)
+	{
+		return left.view() != right;
+	}
+
+	template <typename LeftEncoding, typename LeftPage, typename RightEncoding, typename RightPage, typename RightAllocator, typename RightLayout, typename std::enable_if<
+		!std::is_same<LeftEncoding, RightEncoding>::value || !std::is_same<LeftPage, RightPage>::value, int>::type = 0>
+	bool operator == (basic_string_view<LeftEncoding, LeftPage> left, const basic_string<RightEncoding, RightPage, RightAllocator, RightLayout>& right)
+	{
+		return left == right.view();
+	}
+
+	template <typename LeftEncoding, typename LeftPage, typename RightEncoding, typename RightPage, typename RightAllocator, typename RightLayout, typename std::enable_if<
+		!std::is_same<LeftEncoding, RightEncoding>::value || !std::is_same<LeftPage, RightPage>::value, int>::type = 0>
+	bool operator != (basic_string_view<LeftEncoding, LeftPage> left, const basic_string<RightEncoding, RightPage, RightAllocator, RightLayout>& right)
+	{
+		return left != right.view();
+	}
+
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout, typename RightAllocator, typename RightLayout>
+	bool operator < (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right) noexcept(noexcept(left.compare(right)))
 	{
 		return left.compare(right) < 0;
 	}
 
-	template <typename Encoding, typename Page, typename LeftAllocator, typename RightAllocator>
-	bool operator > (const basic_string<Encoding, Page, LeftAllocator>& left, const basic_string<Encoding, Page, RightAllocator>& right) noexcept(noexcept(left.compare(right)))
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout, typename RightAllocator, typename RightLayout>
+	bool operator > (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right) noexcept(noexcept(left.compare(right)))
 	{
 		return left.compare(right) > 0;
 	}
 
-	template <typename Encoding, typename Page, typename LeftAllocator, typename RightAllocator>
-	bool operator <= (const basic_string<Encoding, Page, LeftAllocator>& left, const basic_string<Encoding, Page, RightAllocator>& right) noexcept(noexcept(left.compare(right)))
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout, typename RightAllocator, typename RightLayout>
+	bool operator <= (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right) noexcept(noexcept(left.compare(right)))
 	{
 		return left.compare(right) <= 0;
 	}
 
-	template <typename Encoding, typename Page, typename LeftAllocator, typename RightAllocator>
-	bool operator >= (const basic_string<Encoding, Page, LeftAllocator>& left, const basic_string<Encoding, Page, RightAllocator>& right) noexcept(noexcept(left.compare(right)))
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout, typename RightAllocator, typename RightLayout>
+	bool operator >= (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right) noexcept(noexcept(left.compare(right)))
 	{
 		return left.compare(right) >= 0;
 	}
 
 
-	template <typename Encoding, typename Page, typename LeftAllocator>
-	bool operator == (const basic_string<Encoding, Page, LeftAllocator>& left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout>
+	bool operator == (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
 	{
-		return left.compare(right) == 0;
+		return left.view() == right;
 	}
 
-	template <typename Encoding, typename Page, typename LeftAllocator>
-	bool operator != (const basic_string<Encoding, Page, LeftAllocator>& left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout>
+	bool operator != (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
 	{
-		return left.compare(right) != 0;
+		return left.view() != right;
 	}
 
-	template <typename Encoding, typename Page, typename LeftAllocator>
-	bool operator < (const basic_string<Encoding, Page, LeftAllocator>& left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout>
+	bool operator < (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
 	{
 		return left.compare(right) < 0;
 	}
 
-	template <typename Encoding, typename Page, typename LeftAllocator>
-	bool operator > (const basic_string<Encoding, Page, LeftAllocator>& left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout>
+	bool operator > (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
 	{
 		return left.compare(right) > 0;
 	}
 
-	template <typename Encoding, typename Page, typename LeftAllocator>
-	bool operator <= (const basic_string<Encoding, Page, LeftAllocator>& left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout>
+	bool operator <= (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
 	{
 		return left.compare(right) <= 0;
 	}
 
-	template <typename Encoding, typename Page, typename LeftAllocator>
-	bool operator >= (const basic_string<Encoding, Page, LeftAllocator>& left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout>
+	bool operator >= (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
 	{
 		return left.compare(right) >= 0;
 	}
 
 
-	template <typename Encoding, typename Page, typename RightAllocator>
-	bool operator == (basic_string_view<Encoding, Page> left, const basic_string<Encoding, Page, RightAllocator>& right) noexcept(noexcept(left.compare(right)))
+	template <typename Encoding, typename Page, typename RightAllocator, typename RightLayout>
+	bool operator == (basic_string_view<Encoding, Page> left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right) noexcept(noexcept(left.compare(right)))
 	{
-		return left.compare(right) == 0;
+		return left == right.view();
 	}
 
-	template <typename Encoding, typename Page, typename RightAllocator>
-	bool operator != (basic_string_view<Encoding, Page> left, const basic_string<Encoding, Page, RightAllocator>& right) noexcept(noexcept(left.compare(right)))
+	template <typename Encoding, typename Page, typename RightAllocator, typename RightLayout>
+	bool operator != (basic_string_view<Encoding, Page> left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right) noexcept(noexcept(left.compare(right)))
 	{
-		return left.compare(right) != 0;
+		return left != right.view();
 	}
 
-	template <typename Encoding, typename Page, typename RightAllocator>
-	bool operator < (basic_string_view<Encoding, Page> left, const basic_string<Encoding, Page, RightAllocator>& right) noexcept(noexcept(left.compare(right)))
+	template <typename Encoding, typename Page, typename RightAllocator, typename RightLayout>
+	bool operator < (basic_string_view<Encoding, Page> left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right) noexcept(noexcept(left.compare(right)))
 	{
 		return left.compare(right) < 0;
 	}
 
-	template <typename Encoding, typename Page, typename RightAllocator>
-	bool operator > (basic_string_view<Encoding, Page> left, const basic_string<Encoding, Page, RightAllocator>& right) noexcept(noexcept(left.compare(right)))
+	template <typename Encoding, typename Page, typename RightAllocator, typename RightLayout>
+	bool operator > (basic_string_view<Encoding, Page> left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right) noexcept(noexcept(left.compare(right)))
 	{
 		return left.compare(right) > 0;
 	}
 
-	template <typename Encoding, typename Page, typename RightAllocator>
-	bool operator <= (basic_string_view<Encoding, Page> left, const basic_string<Encoding, Page, RightAllocator>& right) noexcept(noexcept(left.compare(right)))
+	template <typename Encoding, typename Page, typename RightAllocator, typename RightLayout>
+	bool operator <= (basic_string_view<Encoding, Page> left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right) noexcept(noexcept(left.compare(right)))
 	{
 		return left.compare(right) <= 0;
 	}
 
-	template <typename Encoding, typename Page, typename RightAllocator>
-	bool operator >= (basic_string_view<Encoding, Page> left, const basic_string<Encoding, Page, RightAllocator>& right) noexcept(noexcept(left.compare(right)))
+	template <typename Encoding, typename Page, typename RightAllocator, typename RightLayout>
+	bool operator >= (basic_string_view<Encoding, Page> left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right) noexcept(noexcept(left.compare(right)))
 	{
 		return left.compare(right) >= 0;
 	}
 
 
-	template <typename Encoding, typename Page, typename LeftAllocator,
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value, int>::type = 0>
-	bool operator == (const basic_string<Encoding, Page, LeftAllocator>& left, const typename Encoding::unit_type* right) noexcept(noexcept(left.compare(right)))
+	bool operator == (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, const typename Encoding::unit_type* right) noexcept(noexcept(left.compare(right)))
 	{
 		return left.compare(right) == 0;
 	}
 
-	template <typename Encoding, typename Page, typename LeftAllocator,
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value, int>::type = 0>
-	bool operator != (const basic_string<Encoding, Page, LeftAllocator>& left, const typename Encoding::unit_type* right) noexcept(noexcept(left.compare(right)))
+	bool operator != (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, const typename Encoding::unit_type* right) noexcept(noexcept(left.compare(right)))
 	{
 		return left.compare(right) != 0;
 	}
 
-	template <typename Encoding, typename Page, typename LeftAllocator,
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value, int>::type = 0>
-	bool operator < (const basic_string<Encoding, Page, LeftAllocator>& left, const typename Encoding::unit_type* right) noexcept(noexcept(left.compare(right)))
+	bool operator < (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, const typename Encoding::unit_type* right) noexcept(noexcept(left.compare(right)))
 	{
 		return left.compare(right) < 0;
 	}
 
-	template <typename Encoding, typename Page, typename LeftAllocator,
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value, int>::type = 0>
-	bool operator > (const basic_string<Encoding, Page, LeftAllocator>& left, const typename Encoding::unit_type* right) noexcept(noexcept(left.compare(right)))
+	bool operator > (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, const typename Encoding::unit_type* right) noexcept(noexcept(left.compare(right)))
 	{
 		return left.compare(right) > 0;
 	}
 
-	template <typename Encoding, typename Page, typename LeftAllocator,
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value, int>::type = 0>
-	bool operator <= (const basic_string<Encoding, Page, LeftAllocator>& left, const typename Encoding::unit_type* right) noexcept(noexcept(left.compare(right)))
+	bool operator <= (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, const typename Encoding::unit_type* right) noexcept(noexcept(left.compare(right)))
 	{
 		return left.compare(right) <= 0;
 	}
 
-	template <typename Encoding, typename Page, typename LeftAllocator,
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value, int>::type = 0>
-	bool operator >= (const basic_string<Encoding, Page, LeftAllocator>& left, const typename Encoding::unit_type* right) noexcept(noexcept(left.compare(right)))
+	bool operator >= (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, const typename Encoding::unit_type* right) noexcept(noexcept(left.compare(right)))
 	{
 		return left.compare(right) >= 0;
 	}
 
 
-	template <typename Encoding, typename Page, typename RightAllocator,
+	template <typename Encoding, typename Page, typename RightAllocator, typename RightLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value, int>::type = 0>
-	bool operator == (const typename Encoding::unit_type* left, const basic_string<Encoding, Page, RightAllocator>& right) noexcept(noexcept(right.compare(left)))
+	bool operator == (const typename Encoding::unit_type* left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right) noexcept(noexcept(right.compare(left)))
 	{
 		return right.compare(left) == 0;
 	}
 
-	template <typename Encoding, typename Page, typename RightAllocator,
+	template <typename Encoding, typename Page, typename RightAllocator, typename RightLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value, int>::type = 0>
-	bool operator != (const typename Encoding::unit_type* left, const basic_string<Encoding, Page, RightAllocator>& right) noexcept(noexcept(right.compare(left)))
+	bool operator != (const typename Encoding::unit_type* left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right) noexcept(noexcept(right.compare(left)))
 	{
 		return right.compare(left) != 0;
 	}
 
-	template <typename Encoding, typename Page, typename RightAllocator,
+	template <typename Encoding, typename Page, typename RightAllocator, typename RightLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value, int>::type = 0>
-	bool operator < (const typename Encoding::unit_type* left, const basic_string<Encoding, Page, RightAllocator>& right) noexcept(noexcept(right.compare(left)))
+	bool operator < (const typename Encoding::unit_type* left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right) noexcept(noexcept(right.compare(left)))
 	{
 		return right.compare(left) > 0;
 	}
 
-	template <typename Encoding, typename Page, typename RightAllocator,
+	template <typename Encoding, typename Page, typename RightAllocator, typename RightLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value, int>::type = 0>
-	bool operator > (const typename Encoding::unit_type* left, const basic_string<Encoding, Page, RightAllocator>& right) noexcept(noexcept(right.compare(left)))
+	bool operator > (const typename Encoding::unit_type* left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right) noexcept(noexcept(right.compare(left)))
 	{
 		return right.compare(left) < 0;
 	}
 
-	template <typename Encoding, typename Page, typename RightAllocator,
+	template <typename Encoding, typename Page, typename RightAllocator, typename RightLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value, int>::type = 0>
-	bool operator <= (const typename Encoding::unit_type* left, const basic_string<Encoding, Page, RightAllocator>& right) noexcept(noexcept(right.compare(left)))
+	bool operator <= (const typename Encoding::unit_type* left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right) noexcept(noexcept(right.compare(left)))
 	{
 		return right.compare(left) >= 0;
 	}
 
-	template <typename Encoding, typename Page, typename RightAllocator,
+	template <typename Encoding, typename Page, typename RightAllocator, typename RightLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value, int>::type = 0>
-	bool operator >= (const typename Encoding::unit_type* left, const basic_string<Encoding, Page, RightAllocator>& right) noexcept(noexcept(right.compare(left)))
+	bool operator >= (const typename Encoding::unit_type* left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right) noexcept(noexcept(right.compare(left)))
 	{
 		return right.compare(left) <= 0;
 	}
 
 	
 	#ifndef LINGO_DISABLE_CHAR_COMPATIBILITY
-	template <typename Encoding, typename Page, typename LeftAllocator,
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value && lingo::utility::is_char_compatible<Encoding, Page>::value, int>::type = 0>
-	bool operator == (const basic_string<Encoding, Page, LeftAllocator>& left, const char* right) noexcept(noexcept(left.compare(right)))
+	bool operator == (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, const char* right) noexcept(noexcept(left.compare(right)))
 	{
 		return left == reinterpret_cast<const typename Encoding::unit_type*>(right);
 	}
 
-	template <typename Encoding, typename Page, typename LeftAllocator,
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value && lingo::utility::is_char_compatible<Encoding, Page>::value, int>::type = 0>
-	bool operator != (const basic_string<Encoding, Page, LeftAllocator>& left, const char* right) noexcept(noexcept(left.compare(right)))
+	bool operator != (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, const char* right) noexcept(noexcept(left.compare(right)))
 	{
 		return left == reinterpret_cast<const typename Encoding::unit_type*>(right);
 	}
 
-	template <typename Encoding, typename Page, typename LeftAllocator,
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value && lingo::utility::is_char_compatible<Encoding, Page>::value, int>::type = 0>
-	bool operator < (const basic_string<Encoding, Page, LeftAllocator>& left, const char* right) noexcept(noexcept(left.compare(right)))
+	bool operator < (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, const char* right) noexcept(noexcept(left.compare(right)))
 	{
 		return left < reinterpret_cast<const typename Encoding::unit_type*>(right);
 	}
 
-	template <typename Encoding, typename Page, typename LeftAllocator,
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value && lingo::utility::is_char_compatible<Encoding, Page>::value, int>::type = 0>
-	bool operator > (const basic_string<Encoding, Page, LeftAllocator>& left, const char* right) noexcept(noexcept(left.compare(right)))
+	bool operator > (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, const char* right) noexcept(noexcept(left.compare(right)))
 	{
 		return left > reinterpret_cast<const typename Encoding::unit_type*>(right);
 	}
 
-	template <typename Encoding, typename Page, typename LeftAllocator,
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value && lingo::utility::is_char_compatible<Encoding, Page>::value, int>::type = 0>
-	bool operator <= (const basic_string<Encoding, Page, LeftAllocator>& left, const char* right) noexcept(noexcept(left.compare(right)))
+	bool operator <= (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, const char* right) noexcept(noexcept(left.compare(right)))
 	{
 		return left <= reinterpret_cast<const typename Encoding::unit_type*>(right);
 	}
 
-	template <typename Encoding, typename Page, typename LeftAllocator,
+	template <typename Encoding, typename Page, typename LeftAllocator, typename LeftLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value && lingo::utility::is_char_compatible<Encoding, Page>::value, int>::type = 0>
-	bool operator >= (const basic_string<Encoding, Page, LeftAllocator>& left, const char* right) noexcept(noexcept(left.compare(right)))
+	bool operator >= (const basic_string<Encoding, Page, LeftAllocator, LeftLayout>& left, const char* right) noexcept(noexcept(left.compare(right)))
 	{
 		return left >= reinterpret_cast<const typename Encoding::unit_type*>(right);
 	}
 
 
-	template <typename Encoding, typename Page, typename RightAllocator,
+	template <typename Encoding, typename Page, typename RightAllocator, typename RightLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value && lingo::utility::is_char_compatible<Encoding, Page>::value, int>::type = 0>
-	bool operator == (const char* left, const basic_string<Encoding, Page, RightAllocator>& right) noexcept(noexcept(right.compare(left)))
+	bool operator == (const char* left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right) noexcept(noexcept(right.compare(left)))
 	{
 		return reinterpret_cast<const typename Encoding::unit_type*>(left) == right;
 	}
 
-	template <typename Encoding, typename Page, typename RightAllocator,
+	template <typename Encoding, typename Page, typename RightAllocator, typename RightLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value && lingo::utility::is_char_compatible<Encoding, Page>::value, int>::type = 0>
-	bool operator != (const char* left, const basic_string<Encoding, Page, RightAllocator>& right) noexcept(noexcept(right.compare(left)))
+	bool operator != (const char* left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right) noexcept(noexcept(right.compare(left)))
 	{
 		return reinterpret_cast<const typename Encoding::unit_type*>(left) != right;
 	}
 
-	template <typename Encoding, typename Page, typename RightAllocator,
+	template <typename Encoding, typename Page, typename RightAllocator, typename RightLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value && lingo::utility::is_char_compatible<Encoding, Page>::value, int>::type = 0>
-	bool operator < (const char* left, const basic_string<Encoding, Page, RightAllocator>& right) noexcept(noexcept(right.compare(left)))
+	bool operator < (const char* left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right) noexcept(noexcept(right.compare(left)))
 	{
 		return reinterpret_cast<const typename Encoding::unit_type*>(left) < right;
 	}
 
-	template <typename Encoding, typename Page, typename RightAllocator,
+	template <typename Encoding, typename Page, typename RightAllocator, typename RightLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value && lingo::utility::is_char_compatible<Encoding, Page>::value, int>::type = 0>
-	bool operator > (const char* left, const basic_string<Encoding, Page, RightAllocator>& right) noexcept(noexcept(right.compare(left)))
+	bool operator > (const char* left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right) noexcept(noexcept(right.compare(left)))
 	{
 		return reinterpret_cast<const typename Encoding::unit_type*>(left) > right;
 	}
 
-	template <typename Encoding, typename Page, typename RightAllocator,
+	template <typename Encoding, typename Page, typename RightAllocator, typename RightLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value && lingo::utility::is_char_compatible<Encoding, Page>::value, int>::type = 0>
-	bool operator <= (const char* left, const basic_string<Encoding, Page, RightAllocator>& right) noexcept(noexcept(right.compare(left)))
+	bool operator <= (const char* left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right) noexcept(noexcept(right.compare(left)))
 	{
 		return reinterpret_cast<const typename Encoding::unit_type*>(left) <= right;
 	}
 
-	template <typename Encoding, typename Page, typename RightAllocator,
+	template <typename Encoding, typename Page, typename RightAllocator, typename RightLayout,
 		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value && lingo::utility::is_char_compatible<Encoding, Page>::value, int>::type = 0>
-	bool operator >= (const char* left, const basic_string<Encoding, Page, RightAllocator>& right) noexcept(noexcept(right.compare(left)))
+	bool operator >= (const char* left, const basic_string<Encoding, Page, RightAllocator, RightLayout>& right) noexcept(noexcept(right.compare(left)))
 	{
 		return reinterpret_cast<const typename Encoding::unit_type*>(left) >= right;
 	}
 	#endif
 
-	template <typename Unit, typename Allocator>
+	template <typename Unit, typename Allocator, typename Layout>
 	typename std::enable_if<std::is_same<Unit, typename Allocator::value_type>::value, std::basic_ostream<Unit>&>::type 
 		operator << (std::basic_ostream<Unit>& os,
-			const lingo::basic_string<encoding::execution_encoding_t<Unit>, page::execution_page_t<Unit>, Allocator>& str)
+			const lingo::basic_string<encoding::execution_encoding_t<Unit>, page::execution_page_t<Unit>, Allocator, Layout>& str)
 	{
 		return os.write(str.data(), static_cast<std::streamsize>(str.size()));
 	}
@@ -1451,38 +1820,38 @@ namespace lingo
 namespace lingo
 {
 	// Fixed page typedefs
-	template <typename Encoding, typename Allocator = internal::default_allocator<Encoding>>
-	using basic_ascii_string = basic_string<Encoding, page::ascii, Allocator>;
-	template <typename Encoding, typename Allocator = internal::default_allocator<Encoding>>
-	using basic_unicode_string = basic_string<Encoding, page::unicode_default, Allocator>;
+	template <typename Encoding, typename Allocator = internal::default_allocator<Encoding>, typename Layout = string_layout::standard>
+	using basic_ascii_string = basic_string<Encoding, page::ascii, Allocator, Layout>;
+	template <typename Encoding, typename Allocator = internal::default_allocator<Encoding>, typename Layout = string_layout::standard>
+	using basic_unicode_string = basic_string<Encoding, page::unicode_default, Allocator, Layout>;
 
 	// Fixed encoding typedefs
-	template <typename Unit, typename Allocator = internal::default_allocator<encoding::utf8<Unit, char32_t>>>
-	using basic_utf8_string = basic_unicode_string<encoding::utf8<Unit, char32_t>, Allocator>;
-	template <typename Unit, typename Allocator = internal::default_allocator<encoding::utf8<Unit, char32_t>>>
-	using basic_utf8_le_string = basic_unicode_string<encoding::utf8_le<Unit, char32_t>, Allocator>;
-	template <typename Unit, typename Allocator = internal::default_allocator<encoding::utf8<Unit, char32_t>>>
-	using basic_utf8_be_string = basic_unicode_string<encoding::utf8_be<Unit, char32_t>, Allocator>;
-
-	template <typename Unit, typename Allocator = internal::default_allocator<encoding::utf8<Unit, char32_t>>>
-	using basic_utf16_string = basic_unicode_string<encoding::utf16<Unit, char32_t>, Allocator>;
-	template <typename Unit, typename Allocator = internal::default_allocator<encoding::utf8<Unit, char32_t>>>
-	using basic_utf16_le_string = basic_unicode_string<encoding::utf16_le<Unit, char32_t>, Allocator>;
-	template <typename Unit, typename Allocator = internal::default_allocator<encoding::utf8<Unit, char32_t>>>
-	using basic_utf16_be_string = basic_unicode_string<encoding::utf16_be<Unit, char32_t>, Allocator>;
-
-	template <typename Unit, typename Allocator = internal::default_allocator<encoding::none<Unit, char32_t>>>
-	using basic_utf32_string = basic_unicode_string<encoding::utf32<Unit, char32_t>, Allocator>;
-	template <typename Unit, typename Allocator = internal::default_allocator<encoding::none<Unit, char32_t>>>
-	using basic_utf32_le_string = basic_unicode_string<encoding::utf32_le<Unit, char32_t>, Allocator>;
-	template <typename Unit, typename Allocator = internal::default_allocator<encoding::none<Unit, char32_t>>>
-	using basic_utf32_be_string = basic_unicode_string<encoding::utf32_be<Unit, char32_t>, Allocator>;
+	template <typename Unit, typename Allocator = internal::default_allocator<encoding::utf8<Unit, char32_t>>, typename Layout = string_layout::standard>
+	using basic_utf8_string = basic_unicode_string<encoding::utf8<Unit, char32_t>, Allocator, Layout>;
+	template <typename Unit, typename Allocator = internal::default_allocator<encoding::utf8<Unit, char32_t>>, typename Layout = string_layout::standard>
+	using basic_utf8_le_string = basic_unicode_string<encoding::utf8_le<Unit, char32_t>, Allocator, Layout>;
+	template <typename Unit, typename Allocator = internal::default_allocator<encoding::utf8<Unit, char32_t>>, typename Layout = string_layout::standard>
+	using basic_utf8_be_string = basic_unicode_string<encoding::utf8_be<Unit, char32_t>, Allocator, Layout>;
+
+	template <typename Unit, typename Allocator = internal::default_allocator<encoding::utf8<Unit, char32_t>>, typename Layout = string_layout::standard>
+	using basic_utf16_string = basic_unicode_string<encoding::utf16<Unit, char32_t>, Allocator, Layout>;
+	template <typename Unit, typename Allocator = internal::default_allocator<encoding::utf8<Unit, char32_t>>, typename Layout = string_layout::standard>
+	using basic_utf16_le_string = basic_unicode_string<encoding::utf16_le<Unit, char32_t>, Allocator, Layout>;
+	template <typename Unit, typename Allocator = internal::default_allocator<encoding::utf8<Unit, char32_t>>, typename Layout = string_layout::standard>
+	using basic_utf16_be_string = basic_unicode_string<encoding::utf16_be<Unit, char32_t>, Allocator, Layout>;
+
+	template <typename Unit, typename Allocator = internal::default_allocator<encoding::none<Unit, char32_t>>, typename Layout = string_layout::standard>
+	using basic_utf32_string = basic_unicode_string<encoding::utf32<Unit, char32_t>, Allocator, Layout>;
+	template <typename Unit, typename Allocator = internal::default_allocator<encoding::none<Unit, char32_t>>, typename Layout = string_layout::standard>
+	using basic_utf32_le_string = basic_unicode_string<encoding::utf32_le<Unit, char32_t>, Allocator, Layout>;
+	template <typename Unit, typename Allocator = internal::default_allocator<encoding::none<Unit, char32_t>>, typename Layout = string_layout::standard>
+	using basic_utf32_be_string = basic_unicode_string<encoding::utf32_be<Unit, char32_t>, Allocator, Layout>;
 
 	// Fixed encoding & page typedefs
-	template <typename Allocator = internal::default_allocator<encoding::execution_encoding_t<char>>>
-	using basic_narrow_string = basic_string<encoding::execution_encoding_t<char>, page::execution_page_t<char>, Allocator>;
-	template <typename Allocator = internal::default_allocator<encoding::execution_encoding_t<wchar_t>>>
-	using basic_wide_string = basic_string<encoding::execution_encoding_t<wchar_t>, page::execution_page_t<wchar_t>, Allocator>;
+	template <typename Allocator = internal::default_allocator<encoding::execution_encoding_t<char>>, typename Layout = string_layout::standard>
+	using basic_narrow_string = basic_string<encoding::execution_encoding_t<char>, page::execution_page_t<char>, Allocator, Layout>;
+	template <typename Allocator = internal::default_allocator<encoding::execution_encoding_t<wchar_t>>, typename Layout = string_layout::standard>
+	using basic_wide_string = basic_string<encoding::execution_encoding_t<wchar_t>, page::execution_page_t<wchar_t>, Allocator, Layout>;
 
 	// Fully specialized typedefs
 	using narrow_string = basic_narrow_string<>;
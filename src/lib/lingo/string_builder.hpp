@@ -0,0 +1,362 @@
+#ifndef H_LINGO_STRING_BUILDER
+#define H_LINGO_STRING_BUILDER
+
+#include <lingo/platform/constexpr.hpp>
+
+#include <lingo/string.hpp>
+#include <lingo/string_converter.hpp>
+#include <lingo/string_view.hpp>
+
+#include <lingo/error/error_code.hpp>
+#include <lingo/error/exception.hpp>
+
+#include <lingo/utility/item_traits.hpp>
+#include <lingo/utility/span.hpp>
+#include <lingo/utility/type_traits.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace lingo
+{
+	// Accumulates a string out of many small pieces
+	// The units are appended to a list of chunks that are never moved or copied while the string is being built,
+	// so the builder only holds about as much memory as the final string.
+	// If all units fit in a single chunk, for example because reserve() was called with the final size, build() hands that chunk to the string without copying.
+	// Otherwise build() copies the chunks into a single new allocation, so memory peaks at about twice the final size while the chunks are copied.
+	template <typename Encoding, typename Page, typename Allocator = internal::default_allocator<Encoding>>
+	class basic_string_builder
+	{
+		public:
+		using encoding_type = Encoding;
+		using page_type = Page;
+		using allocator_type = Allocator;
+
+		using unit_type = typename encoding_type::unit_type;
+		using point_type = typename encoding_type::point_type;
+
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+
+		using const_pointer = const unit_type*;
+
+		using string_type = basic_string<encoding_type, page_type, allocator_type>;
+		using string_view_type = basic_string_view<encoding_type, page_type>;
+
+		static LINGO_CONSTEXPR11 const bool is_execution_set = lingo::utility::is_execution_set<encoding_type, page_type>::value;
+		static LINGO_CONSTEXPR11 const bool is_char_compatible = lingo::utility::is_char_compatible<encoding_type, page_type>::value;
+
+		// The capacity of new chunks grows with the size of the builder, between these two limits
+		// The upper limit keeps the unused space at the end of the last chunk small for large strings
+		static LINGO_CONSTEXPR11 const size_type minimum_chunk_size = 256;
+		static LINGO_CONSTEXPR11 const size_type maximum_chunk_size = 65536;
+
+		private:
+		static_assert(std::is_same<unit_type, typename allocator_type::value_type>::value, "allocator_type::value_type must be the same type as basic_string_builder::unit_type");
+
+		using copy_items = utility::copy_items<unit_type>;
+		using allocator_traits = std::allocator_traits<allocator_type>;
+
+		// Every chunk allocates one unit more than its capacity, so that build() can add a null terminator and adopt it
+		struct chunk
+		{
+			unit_type* data;
+			size_type size;
+			size_type capacity;
+		};
+
+		using chunk_allocator_type = typename std::allocator_traits<allocator_type>::template rebind_alloc<chunk>;
+
+		public:
+		basic_string_builder():
+			basic_string_builder(allocator_type())
+		{
+		}
+
+		explicit basic_string_builder(const allocator_type& allocator):
+			_allocator(allocator),
+			_chunks(chunk_allocator_type(allocator)),
+			_size(0)
+		{
+		}
+
+		basic_string_builder(const basic_string_builder&) = delete;
+
+		basic_string_builder(basic_string_builder&& builder) noexcept:
+			_allocator(builder._allocator),
+			_chunks(std::move(builder._chunks)),
+			_size(builder._size)
+		{
+			builder._chunks.clear();
+			builder._size = 0;
+		}
+
+		~basic_string_builder()
+		{
+			clear();
+		}
+
+		basic_string_builder& operator = (const basic_string_builder&) = delete;
+
+		basic_string_builder& operator = (basic_string_builder&& builder) noexcept
+		{
+			if (this != &builder)
+			{
+				clear();
+				_allocator = builder._allocator;
+				_chunks = std::move(builder._chunks);
+				_size = builder._size;
+				builder._chunks.clear();
+				builder._size = 0;
+			}
+			return *this;
+		}
+
+		allocator_type get_allocator() const noexcept
+		{
+			return _allocator;
+		}
+
+		// The amount of units that have been appended so far
+		size_type size() const noexcept
+		{
+			return _size;
+		}
+
+		bool empty() const noexcept
+		{
+			return _size == 0;
+		}
+
+		// Releases all chunks
+		void clear() noexcept
+		{
+			for (const chunk& current : _chunks)
+			{
+				allocator_traits::deallocate(_allocator, current.data, current.capacity + 1);
+			}
+
+			_chunks.clear();
+			_size = 0;
+		}
+
+		// Makes sure that the next count units can be appended without allocating another chunk
+		void reserve(size_type count)
+		{
+			if (_chunks.empty() || _chunks.back().capacity - _chunks.back().size < count)
+			{
+				add_chunk(count);
+			}
+		}
+
+		void append(string_view_type str)
+		{
+			append_units(str.data(), str.size());
+		}
+
+		template <typename StringAllocator, typename StringLayout>
+		void append(const basic_string<encoding_type, page_type, StringAllocator, StringLayout>& str)
+		{
+			append_units(str.data(), str.size());
+		}
+
+		template <typename _ = int, typename std::enable_if<is_execution_set, _>::type = 0>
+		void append(const_pointer str)
+		{
+			append(string_view_type(str));
+		}
+
+		#if !defined(LINGO_DISABLE_CHAR_COMPATIBILITY)
+		template <typename _ = int, typename std::enable_if<is_execution_set && is_char_compatible, _>::type = 0, typename = void>
+		void append(const char* str)
+		{
+			append(reinterpret_cast<const_pointer>(str));
+		}
+		#endif
+
+		void append(point_type point)
+		{
+			append(1, point);
+		}
+
+		void append(size_type count, point_type point)
+		{
+			// Encode the point into units
+			unit_type encoded_point[encoding_type::max_units];
+			const auto result = encoding_type::encode_one(utility::span<point_type>(&point, 1), encoded_point);
+			if (result.error != error::error_code::success)
+			{
+				throw error::exception(result.error);
+			}
+
+			const size_type point_size = static_cast<size_type>(result.destination.data() - encoded_point);
+			for (size_type i = 0; i < count; ++i)
+			{
+				append_units(encoded_point, point_size);
+			}
+		}
+
+		// Converts the string directly into the chunks, without creating a temporary string
+		template <typename SourceEncoding, typename SourcePage, typename std::enable_if<
+			!std::is_same<SourceEncoding, encoding_type>::value || !std::is_same<SourcePage, page_type>::value, int>::type = 0>
+		void append(basic_string_view<SourceEncoding, SourcePage> str)
+		{
+			using converter_type = string_converter<SourceEncoding, SourcePage, encoding_type, page_type>;
+			using source_unit_type = typename SourceEncoding::unit_type;
+
+			size_type total_units_read = 0;
+			while (total_units_read < str.size())
+			{
+				// Every converted point needs room for at least max_units
+				reserve(encoding_type::max_units);
+				chunk& current = _chunks.back();
+
+				const conversion_result result = converter_type().convert(
+					utility::span<const source_unit_type>(str.data() + total_units_read, str.size() - total_units_read),
+					utility::span<unit_type>(current.data + current.size, current.capacity - current.size),
+					true);
+
+				current.size += result.destination_written;
+				_size += result.destination_written;
+				total_units_read += result.source_read;
+
+				// No progress was made while there was enough room for a point, so the error handler gave up
+				if (result.source_read == 0)
+				{
+					break;
+				}
+			}
+		}
+
+		template <typename SourceEncoding, typename SourcePage, typename SourceAllocator, typename SourceLayout, typename std::enable_if<
+			!std::is_same<SourceEncoding, encoding_type>::value || !std::is_same<SourcePage, page_type>::value, int>::type = 0>
+		void append(const basic_string<SourceEncoding, SourcePage, SourceAllocator, SourceLayout>& str)
+		{
+			append(str.view());
+		}
+
+		// Copies all chunks into a new string
+		string_type str() const
+		{
+			string_type result(_allocator);
+			result.reserve(_size);
+			for (const chunk& current : _chunks)
+			{
+				result.append(string_view_type(current.data, current.size, false));
+			}
+			return result;
+		}
+
+		// Moves all chunks into a new string, and leaves the builder empty
+		// A single chunk becomes the buffer of the string, more chunks are copied and released as soon as they have been copied
+		string_type build()
+		{
+			string_type result(_allocator);
+			if (_chunks.size() == 1)
+			{
+				const chunk current = _chunks.back();
+				_chunks.clear();
+				_size = 0;
+				result.adopt(current.data, current.size, current.capacity, _allocator);
+				return result;
+			}
+
+			result.reserve(_size);
+			for (const chunk& current : _chunks)
+			{
+				result.append(string_view_type(current.data, current.size, false));
+				allocator_traits::deallocate(_allocator, current.data, current.capacity + 1);
+			}
+
+			_chunks.clear();
+			_size = 0;
+			return result;
+		}
+
+		private:
+		void append_units(const unit_type* units, size_type count)
+		{
+			// Fill up the last chunk before starting a new one
+			if (!_chunks.empty())
+			{
+				chunk& current = _chunks.back();
+				const size_type copied = (std::min)(count, current.capacity - current.size);
+				copy_items{}(current.data + current.size, units, copied);
+				current.size += copied;
+				_size += copied;
+				units += copied;
+				count -= copied;
+			}
+
+			if (count > 0)
+			{
+				add_chunk(count);
+				chunk& current = _chunks.back();
+				copy_items{}(current.data, units, count);
+				current.size = count;
+				_size += count;
+			}
+		}
+
+		void add_chunk(size_type minimum_capacity)
+		{
+			const size_type capacity = (std::max)(minimum_capacity, (std::min)((std::max)(_size, minimum_chunk_size), maximum_chunk_size));
+
+			// Make room for the chunk first, so that the allocation can not leak if growing the list throws
+			if (_chunks.size() == _chunks.capacity())
+			{
+				_chunks.reserve((std::max)(_chunks.size() * 2, size_type(4)));
+			}
+
+			chunk new_chunk;
+			new_chunk.data = allocator_traits::allocate(_allocator, capacity + 1);
+			new_chunk.size = 0;
+			new_chunk.capacity = capacity;
+			_chunks.push_back(new_chunk);
+		}
+
+		allocator_type _allocator;
+		std::vector<chunk, chunk_allocator_type> _chunks;
+		size_type _size;
+	};
+
+	template <typename Encoding, typename Page, typename Allocator>
+	LINGO_CONSTEXPR11 const bool basic_string_builder<Encoding, Page, Allocator>::is_execution_set;
+
+	template <typename Encoding, typename Page, typename Allocator>
+	LINGO_CONSTEXPR11 const bool basic_string_builder<Encoding, Page, Allocator>::is_char_compatible;
+
+	template <typename Encoding, typename Page, typename Allocator>
+	LINGO_CONSTEXPR11 const typename basic_string_builder<Encoding, Page, Allocator>::size_type basic_string_builder<Encoding, Page, Allocator>::minimum_chunk_size;
+
+	template <typename Encoding, typename Page, typename Allocator>
+	LINGO_CONSTEXPR11 const typename basic_string_builder<Encoding, Page, Allocator>::size_type basic_string_builder<Encoding, Page, Allocator>::maximum_chunk_size;
+
+	template <typename Encoding, typename Allocator = internal::default_allocator<Encoding>>
+	using basic_unicode_string_builder = basic_string_builder<Encoding, page::unicode_default, Allocator>;
+
+	template <typename Unit, typename Allocator = internal::default_allocator<encoding::utf8<Unit, char32_t>>>
+	using basic_utf8_string_builder = basic_unicode_string_builder<encoding::utf8<Unit, char32_t>, Allocator>;
+	template <typename Unit, typename Allocator = internal::default_allocator<encoding::utf16<Unit, char32_t>>>
+	using basic_utf16_string_builder = basic_unicode_string_builder<encoding::utf16<Unit, char32_t>, Allocator>;
+	template <typename Unit, typename Allocator = internal::default_allocator<encoding::utf32<Unit, char32_t>>>
+	using basic_utf32_string_builder = basic_unicode_string_builder<encoding::utf32<Unit, char32_t>, Allocator>;
+
+	#ifdef __cpp_char8_t
+	using utf8_string_builder = basic_utf8_string_builder<char8_t>;
+	#else
+	using utf8_string_builder = basic_utf8_string_builder<char>;
+	#endif
+
+	using utf16_string_builder = basic_utf16_string_builder<char16_t>;
+	using utf32_string_builder = basic_utf32_string_builder<char32_t>;
+
+	// Default string builder typedef
+	using string_builder = utf8_string_builder;
+}
+
+#endif
@@ -0,0 +1,218 @@
+#ifndef H_LINGO_STRING_CONCATENATION
+#define H_LINGO_STRING_CONCATENATION
+
+#include <lingo/platform/constexpr.hpp>
+
+#include <lingo/string.hpp>
+#include <lingo/string_view.hpp>
+
+#include <lingo/error/error_code.hpp>
+#include <lingo/error/exception.hpp>
+
+#include <lingo/utility/span.hpp>
+#include <lingo/utility/type_traits.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace lingo
+{
+	namespace internal
+	{
+		// A string operand of a concatenation, or an encoded point if data is a null pointer
+		template <typename Encoding>
+		struct concatenation_operand
+		{
+			const typename Encoding::unit_type* data;
+			std::size_t size;
+			typename Encoding::unit_type units[Encoding::max_units];
+		};
+	}
+
+	// Records the operands of a chain of concatenations, and builds the resulting string with a single allocation
+	// Created with lingo::concat, after which strings, string views, points and C strings can be added with operator +
+	// The concatenation only refers to its string operands, so it must be turned into a string before they go out of scope.
+	template <typename Encoding, typename Page, std::size_t Count>
+	class basic_string_concatenation
+	{
+		public:
+		using encoding_type = Encoding;
+		using page_type = Page;
+
+		using unit_type = typename encoding_type::unit_type;
+		using point_type = typename encoding_type::point_type;
+
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+
+		using string_view_type = basic_string_view<encoding_type, page_type>;
+
+		private:
+		static_assert(Count > 0, "A concatenation needs at least one operand");
+
+		using operand = internal::concatenation_operand<encoding_type>;
+
+		public:
+		explicit basic_string_concatenation(string_view_type string) noexcept:
+			_size(string.size())
+		{
+			static_assert(Count == 1, "A concatenation can only be started with a single operand");
+			_operands[0].data = string.data();
+			_operands[0].size = string.size();
+		}
+
+		template <std::size_t LeftCount, typename std::enable_if<LeftCount + 1 == Count, int>::type = 0>
+		basic_string_concatenation(const basic_string_concatenation<encoding_type, page_type, LeftCount>& left, string_view_type right) noexcept:
+			_size(left.size() + right.size())
+		{
+			copy_operands(left);
+			_operands[Count - 1].data = right.data();
+			_operands[Count - 1].size = right.size();
+		}
+
+		template <std::size_t LeftCount, typename std::enable_if<LeftCount + 1 == Count, int>::type = 0>
+		basic_string_concatenation(const basic_string_concatenation<encoding_type, page_type, LeftCount>& left, point_type right):
+			_size(left.size())
+		{
+			copy_operands(left);
+
+			operand& point_operand = _operands[Count - 1];
+			const auto result = encoding_type::encode_one(utility::span<point_type>(&right, 1), point_operand.units);
+			if (result.error != error::error_code::success)
+			{
+				throw error::exception(result.error);
+			}
+
+			point_operand.data = nullptr;
+			point_operand.size = static_cast<size_type>(result.destination.data() - point_operand.units);
+			_size += point_operand.size;
+		}
+
+		// The total amount of units of the resulting string
+		size_type size() const noexcept
+		{
+			return _size;
+		}
+
+		template <typename Allocator = internal::default_allocator<encoding_type>, typename Layout = string_layout::standard>
+		basic_string<encoding_type, page_type, Allocator, Layout> str(const Allocator& allocator = Allocator()) const
+		{
+			basic_string<encoding_type, page_type, Allocator, Layout> result(allocator);
+			result.reserve(_size);
+			append_to(result);
+			return result;
+		}
+
+		template <typename Allocator, typename Layout>
+		operator basic_string<encoding_type, page_type, Allocator, Layout>() const
+		{
+			return str<Allocator, Layout>();
+		}
+
+		// Appends the result to an existing string, growing it at most once
+		// Operands that refer to the string itself are allowed, the result is then built in a new string that replaces it.
+		template <typename Allocator, typename Layout>
+		void append_to(basic_string<encoding_type, page_type, Allocator, Layout>& string) const
+		{
+			if (refers_to(string.view()))
+			{
+				basic_string<encoding_type, page_type, Allocator, Layout> result(string.get_allocator());
+				result.reserve(string.size() + _size);
+				result.append(string.view());
+				append_operands(result);
+				string = std::move(result);
+				return;
+			}
+
+			string.reserve(string.size() + _size);
+			append_operands(string);
+		}
+
+		private:
+		template <typename Allocator, typename Layout>
+		void append_operands(basic_string<encoding_type, page_type, Allocator, Layout>& string) const
+		{
+			for (const operand& current : _operands)
+			{
+				string.append(string_view_type(current.data != nullptr ? current.data : current.units, current.size, false));
+			}
+		}
+
+		// Whether any string operand points into str, whose buffer would be freed when the string grows
+		bool refers_to(string_view_type str) const noexcept
+		{
+			for (const operand& current : _operands)
+			{
+				if (current.data != nullptr && current.data >= str.data() && current.data <= str.data() + str.size())
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		template <typename Encoding2, typename Page2, std::size_t Count2>
+		friend class basic_string_concatenation;
+
+		template <std::size_t LeftCount>
+		void copy_operands(const basic_string_concatenation<encoding_type, page_type, LeftCount>& left) noexcept
+		{
+			for (size_type i = 0; i < LeftCount; ++i)
+			{
+				_operands[i] = left._operands[i];
+			}
+		}
+
+		size_type _size;
+		operand _operands[Count];
+	};
+
+	template <typename Encoding, typename Page>
+	basic_string_concatenation<Encoding, Page, 1> concat(basic_string_view<Encoding, Page> string) noexcept
+	{
+		return basic_string_concatenation<Encoding, Page, 1>(string);
+	}
+
+	template <typename Encoding, typename Page, typename Allocator, typename Layout>
+	basic_string_concatenation<Encoding, Page, 1> concat(const basic_string<Encoding, Page, Allocator, Layout>& string) noexcept
+	{
+		return basic_string_concatenation<Encoding, Page, 1>(string.view());
+	}
+
+	template <typename Encoding, typename Page, std::size_t Count>
+	basic_string_concatenation<Encoding, Page, Count + 1> operator + (const basic_string_concatenation<Encoding, Page, Count>& left, basic_string_view<Encoding, Page> right) noexcept
+	{
+		return basic_string_concatenation<Encoding, Page, Count + 1>(left, right);
+	}
+
+	template <typename Encoding, typename Page, std::size_t Count, typename Allocator, typename Layout>
+	basic_string_concatenation<Encoding, Page, Count + 1> operator + (const basic_string_concatenation<Encoding, Page, Count>& left, const basic_string<Encoding, Page, Allocator, Layout>& right) noexcept
+	{
+		return basic_string_concatenation<Encoding, Page, Count + 1>(left, right.view());
+	}
+
+	template <typename Encoding, typename Page, std::size_t Count>
+	basic_string_concatenation<Encoding, Page, Count + 1> operator + (const basic_string_concatenation<Encoding, Page, Count>& left, typename Encoding::point_type right)
+	{
+		return basic_string_concatenation<Encoding, Page, Count + 1>(left, right);
+	}
+
+	template <typename Encoding, typename Page, std::size_t Count,
+		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value, int>::type = 0>
+	basic_string_concatenation<Encoding, Page, Count + 1> operator + (const basic_string_concatenation<Encoding, Page, Count>& left, const typename Encoding::unit_type* right) noexcept
+	{
+		return basic_string_concatenation<Encoding, Page, Count + 1>(left, basic_string_view<Encoding, Page>(right));
+	}
+
+	#ifndef LINGO_DISABLE_CHAR_COMPATIBILITY
+	template <typename Encoding, typename Page, std::size_t Count,
+		typename std::enable_if<lingo::utility::is_execution_set<Encoding, Page>::value && lingo::utility::is_char_compatible<Encoding, Page>::value, int>::type = 0>
+	basic_string_concatenation<Encoding, Page, Count + 1> operator + (const basic_string_concatenation<Encoding, Page, Count>& left, const char* right) noexcept
+	{
+		return left + reinterpret_cast<const typename Encoding::unit_type*>(right);
+	}
+	#endif
+}
+
+#endif
@@ -2,26 +2,37 @@
 #define H_LINGO_STRING_CONVERTER
 
 #include <lingo/conversion_result.hpp>
+#include <lingo/converter_kernel.hpp>
+#include <lingo/encoding/unchecked.hpp>
 #include <lingo/encoding/utf8.hpp>
+#include <lingo/error/error_report.hpp>
+#include <lingo/error/replace.hpp>
+#include <lingo/error/skip.hpp>
 #include <lingo/error/strict.hpp>
 #include <lingo/page/point_mapper.hpp>
 #include <lingo/page/unicode.hpp>
 #include <lingo/platform/warnings.hpp>
+#include <lingo/string_layout.hpp>
 
 #include <cassert>
 #include <cstddef>
+#include <type_traits>
 
 namespace lingo
 {
-	template <typename Encoding, typename Page, typename Allocator>
+	template <typename Encoding, typename Page, typename Allocator, typename Layout>
 	class basic_string;
 
 	template <typename Encoding, typename Page>
 	class basic_string_view;
 
+	template <typename Encoding, typename Page>
+	class basic_validated_string_view;
+
 	template <
 		typename SourceEncoding, typename SourcePage,
-		typename DestinationEncoding, typename DestinationPage>
+		typename DestinationEncoding, typename DestinationPage,
+		template <typename, typename> class ErrorHandler = error::strict>
 	class string_converter
 	{
 		public:
@@ -53,6 +64,9 @@ namespace lingo
 
 		using point_mapper = page::point_mapper<source_page_type, destination_page_type>;
 
+		using source_error_handler_type = ErrorHandler<source_encoding_type, source_page_type>;
+		using destination_error_handler_type = ErrorHandler<destination_encoding_type, destination_page_type>;
+
 		using size_type = std::size_t;
 		using difference_type = std::ptrdiff_t;
 
@@ -61,99 +75,273 @@ namespace lingo
 
 		LINGO_CONSTEXPR14 conversion_result convert(utility::span<const source_unit_type> source, utility::span<destination_unit_type> destination, bool final)
 		{
-			source_decode_source_type read_buffer = source;
-			destination_encode_destination_type write_buffer = destination;
+			error::null_error_report report;
+			return convert(source, destination, final, report);
+		}
 
-			source_decode_state_type read_state;
-			destination_encode_state_type write_state;
-			
-			while (read_buffer.size() > 0 && write_buffer.size() > 0)
+		// Converts the source into the destination and adds every error encountered to the report
+		// The offsets in the report are relative to the start of source
+		template <typename ErrorReport>
+		LINGO_CONSTEXPR14 conversion_result convert(utility::span<const source_unit_type> source, utility::span<destination_unit_type> destination, bool final, ErrorReport& report)
+		{
+			source_decode_state_type read_state{};
+			destination_encode_state_type write_state{};
+			return convert_units<false>(source, destination, final, read_state, write_state, report, 0);
+		}
+
+		LINGO_CONSTEXPR14 conversion_result convert(
+			basic_string_view<source_encoding_type, source_page_type> source,
+			destination_unit_type* destination_buffer, size_type destination_buffer_size)
+		{
+			return convert(
+				utility::span<const source_unit_type>(source.data(), source.size()),
+				utility::span<destination_unit_type>(destination_buffer, destination_buffer_size),
+				true);
+		}
+
+		template <typename Allocator, typename Layout = string_layout::standard>
+		basic_string<destination_encoding_type, destination_page_type, Allocator, Layout> convert(basic_string_view<source_encoding_type, source_page_type> source, const Allocator& allocator = Allocator())
+		{
+			error::null_error_report report;
+			return convert_string<false, Layout>(source, allocator, report);
+		}
+
+		template <typename Allocator, typename Layout = string_layout::standard, typename ErrorReport>
+		basic_string<destination_encoding_type, destination_page_type, Allocator, Layout> convert(basic_string_view<source_encoding_type, source_page_type> source, const Allocator& allocator, ErrorReport& report)
+		{
+			return convert_string<false, Layout>(source, allocator, report);
+		}
+
+		// Validated sources are decoded without any validation
+		template <typename Allocator, typename Layout = string_layout::standard>
+		basic_string<destination_encoding_type, destination_page_type, Allocator, Layout> convert(basic_validated_string_view<source_encoding_type, source_page_type> source, const Allocator& allocator = Allocator())
+		{
+			error::null_error_report report;
+			return convert_string<true, Layout>(source, allocator, report);
+		}
+
+		template <typename Allocator, typename Layout = string_layout::standard, typename ErrorReport>
+		basic_string<destination_encoding_type, destination_page_type, Allocator, Layout> convert(basic_validated_string_view<source_encoding_type, source_page_type> source, const Allocator& allocator, ErrorReport& report)
+		{
+			return convert_string<true, Layout>(source, allocator, report);
+		}
+
+		private:
+		using kernel_type = converter_kernel<source_encoding_type, source_page_type, destination_encoding_type, destination_page_type>;
+
+		template <bool SourceValidated, typename Layout, typename Allocator, typename ErrorReport>
+		basic_string<destination_encoding_type, destination_page_type, Allocator, Layout> convert_string(basic_string_view<source_encoding_type, source_page_type> source, const Allocator& allocator, ErrorReport& report)
+		{
+			basic_string<destination_encoding_type, destination_page_type, Allocator, Layout> string(allocator);
+
+			size_type total_units_read = 0;
+			size_type total_units_written = 0;
+			size_type buffer_size = source.size();
+
+			// The state is kept between iterations, so that stateful encodings can continue where they left off
+			source_decode_state_type read_state{};
+			destination_encode_state_type write_state{};
+
+			while (total_units_read < source.size())
 			{
-				source_point_type source_point;
-				source_decode_destination_type source_point_span(&source_point, 1);
+				// The units are converted straight into the buffer of the string, without initializing it first
+				size_type units_read = 0;
+				string.resize_and_overwrite(buffer_size, [&](destination_unit_type* buffer, size_type size)
+				{
+					const auto result = this->template convert_units<SourceValidated>(
+						utility::span<const source_unit_type>(source.data() + total_units_read, source.size() - total_units_read),
+						utility::span<destination_unit_type>(buffer + total_units_written, size - total_units_written),
+						true, read_state, write_state, report, total_units_read);
+
+					units_read = result.source_read;
+					total_units_read += result.source_read;
+					total_units_written += result.destination_written;
+					return total_units_written;
+				});
 
-				// Try to decode a point from the source
-				auto decode_result = source_encoding_type::decode_one(read_buffer, source_point_span, read_state, final);
-				if (decode_result.error != error::error_code::success)
+				if (total_units_read < source.size())
 				{
-					if (!handle_error(decode_result, read_buffer, source_point_span))
+					// No progress was made while there was enough room for at least one point, so the error handler gave up
+					if (units_read == 0 && buffer_size - total_units_written >= destination_encoding_type::max_units)
 					{
 						break;
 					}
+
+					buffer_size = buffer_size * 2 + destination_encoding_type::max_units;
 				}
+			}
+
+			return string;
+		}
+
+		template <bool SourceValidated, typename ErrorReport>
+		LINGO_CONSTEXPR14 conversion_result convert_units(utility::span<const source_unit_type> source, utility::span<destination_unit_type> destination, bool final,
+			source_decode_state_type& read_state, destination_encode_state_type& write_state,
+			ErrorReport& report, size_type report_offset)
+		{
+			return convert_units<SourceValidated>(source, destination, final, read_state, write_state, report, report_offset,
+				has_converter_kernel<source_encoding_type, source_page_type, destination_encoding_type, destination_page_type>());
+		}
+
+		template <bool SourceValidated, typename ErrorReport>
+		LINGO_CONSTEXPR14 conversion_result convert_units(utility::span<const source_unit_type> source, utility::span<destination_unit_type> destination, bool final,
+			source_decode_state_type& read_state, destination_encode_state_type& write_state,
+			ErrorReport& report, size_type report_offset, std::false_type)
+		{
+			source_decode_source_type read_buffer = source;
+			destination_encode_destination_type write_buffer = destination;
 
-				// Try to map the source points to a destination points
-				destination_point_type destination_point;
-				destination_encode_source_type destination_point_span(&destination_point, 1);
-				const auto map_result = point_mapper::map(source_point);
-				if (map_result.error != error::error_code::success)
+			while (read_buffer.size() > 0 && write_buffer.size() > 0)
+			{
+				if (!convert_one<SourceValidated>(read_buffer, write_buffer, read_state, write_state, final, report, report_offset + (source.size() - read_buffer.size())))
 				{
 					break;
 				}
+			}
 
-				destination_point = map_result.point;
+			return { source.size() - read_buffer.size(), destination.size() - write_buffer.size() };
+		}
 
-				// Try to encode the point into the destination buffer
-				auto encode_result = destination_encoding_type::encode_one(destination_point_span, write_buffer, write_state, decode_result.source.size() == 0 && final);
-				if (encode_result.error != error::error_code::success)
+		template <bool SourceValidated, typename ErrorReport>
+		LINGO_CONSTEXPR14 conversion_result convert_units(utility::span<const source_unit_type> source, utility::span<destination_unit_type> destination, bool final,
+			source_decode_state_type& read_state, destination_encode_state_type& write_state,
+			ErrorReport& report, size_type report_offset, std::true_type)
+		{
+			source_decode_source_type read_buffer = source;
+			destination_encode_destination_type write_buffer = destination;
+
+			while (read_buffer.size() > 0 && write_buffer.size() > 0)
+			{
+				// Let the kernel convert as much as it can
+				const conversion_result kernel_result = kernel_type::convert(read_buffer, write_buffer, final);
+				assert(kernel_result.source_read <= read_buffer.size());
+				assert(kernel_result.destination_written <= write_buffer.size());
+
+				read_buffer = read_buffer.subspan(kernel_result.source_read);
+				write_buffer = write_buffer.subspan(kernel_result.destination_written);
+
+				if (read_buffer.size() == 0 || write_buffer.size() == 0)
 				{
-					// A destination buffer that is too small is not considered an error.
-					// Return from this function and allow the callee to provide more buffer space
-					if (encode_result.error == error::error_code::destination_buffer_too_small)
-					{
-						break;
-					}
-					else if (!handle_error(encode_result, destination_point_span, write_buffer))
-					{
-						break;
-					}
+					break;
 				}
 
-				read_buffer = decode_result.source;
-				write_buffer = encode_result.destination;
+				// The kernel stopped early, convert a single point the slow way before trying the kernel again
+				if (!convert_one<SourceValidated>(read_buffer, write_buffer, read_state, write_state, final, report, report_offset + (source.size() - read_buffer.size())))
+				{
+					break;
+				}
 			}
 
 			return { source.size() - read_buffer.size(), destination.size() - write_buffer.size() };
 		}
 
-		LINGO_CONSTEXPR14 conversion_result convert(
-			basic_string_view<source_encoding_type, source_page_type> source,
-			destination_unit_type* destination_buffer, size_type destination_buffer_size)
+		template <bool SourceValidated, typename ErrorReport>
+		LINGO_CONSTEXPR14 bool convert_one(
+			source_decode_source_type& read_buffer, destination_encode_destination_type& write_buffer,
+			source_decode_state_type& read_state, destination_encode_state_type& write_state,
+			bool final, ErrorReport& report, size_type source_offset)
 		{
-			return convert(source.data(), source.size(), destination_buffer, destination_buffer_size);
-		}
+			source_point_type source_point{};
+			source_decode_destination_type source_point_span(&source_point, 1);
 
-		template <typename Allocator>
-		basic_string<destination_encoding_type, destination_page_type, Allocator> convert(basic_string_view<source_encoding_type, source_page_type> source, const Allocator& allocator = Allocator())
-		{
-			basic_string<destination_encoding_type, destination_page_type, Allocator> string(allocator);
+			// Errors are only reported once the point is consumed, so that a retry with a larger buffer does not report them twice
+			error::error_code decode_error = error::error_code::success;
+			error::error_code encode_error = error::error_code::success;
 
-			string.resize(source.size());
+			// Try to decode a point from the source
+			auto decode_result = decode_one(read_buffer, source_point_span, read_state, final, std::integral_constant<bool, SourceValidated>());
+			if (decode_result.error != error::error_code::success)
+			{
+				// Running out of source units is only an error if no more input will follow
+				if (decode_result.error == error::error_code::source_buffer_too_small && !final)
+				{
+					return false;
+				}
 
-			size_type total_units_read = 0;
-			size_type total_units_written = 0;
+				decode_error = decode_result.error;
+				if (!handle_error(decode_result, read_buffer, source_point_span))
+				{
+					report_failure(report, source_offset, decode_error, decode_result.error);
+					return false;
+				}
 
-			while (total_units_read < source.size())
+				// The error handler dropped the invalid units without producing a point
+				if (decode_result.destination.size() == source_point_span.size())
+				{
+					report.report(source_offset, decode_error);
+					read_buffer = decode_result.source;
+					return true;
+				}
+			}
+
+			// Try to map the source points to a destination points
+			destination_point_type destination_point{};
+			destination_encode_source_type destination_point_span(&destination_point, 1);
+			const auto map_result = point_mapper::map(source_point);
+
+			// A point that does not exist in the destination page is handled as an encoding error
+			destination_encode_result_type encode_result{ destination_point_span, write_buffer, map_result.error };
+			if (map_result.error == error::error_code::success)
 			{
-				auto result = convert(
-					utility::span<const source_unit_type>(source.data() + total_units_read, source.size() - total_units_read),
-					utility::span<destination_unit_type>(string.data() + total_units_written, string.size() - total_units_written),
-					true);
+				destination_point = map_result.point;
 
-				total_units_read += result.source_read;
-				total_units_written += result.destination_written;
+				// Try to encode the point into the destination buffer
+				encode_result = destination_encoding_type::encode_one(destination_point_span, write_buffer, write_state, decode_result.source.size() == 0 && final);
+			}
 
-				if (total_units_read < source.size())
+			if (encode_result.error != error::error_code::success)
+			{
+				// A destination buffer that is too small is not considered an error.
+				// Return from this function and allow the callee to provide more buffer space
+				if (encode_result.error == error::error_code::destination_buffer_too_small)
 				{
-					string.resize(string.size() * 2);
+					return false;
+				}
+
+				encode_error = encode_result.error;
+				if (!handle_error(encode_result, destination_point_span, write_buffer))
+				{
+					report_failure(report, source_offset, decode_error, encode_result.error);
+					report_failure(report, source_offset, encode_error, encode_result.error);
+					return false;
 				}
 			}
 
-			string.resize(total_units_written);
-			return string;
+			if (decode_error != error::error_code::success)
+			{
+				report.report(source_offset, decode_error);
+			}
+
+			if (encode_error != error::error_code::success)
+			{
+				report.report(source_offset, encode_error);
+			}
+
+			read_buffer = decode_result.source;
+			write_buffer = encode_result.destination;
+			return true;
+		}
+
+		static LINGO_CONSTEXPR14 source_decode_result_type decode_one(source_decode_source_type source, source_decode_destination_type destination, source_decode_state_type& state, bool final, std::false_type) noexcept
+		{
+			return source_encoding_type::decode_one(source, destination, state, final);
+		}
+
+		static LINGO_CONSTEXPR14 source_decode_result_type decode_one(source_decode_source_type source, source_decode_destination_type destination, source_decode_state_type& state, bool final, std::true_type) noexcept
+		{
+			return encoding::unchecked<source_encoding_type>::decode_one(source, destination, state, final);
+		}
+
+		template <typename ErrorReport>
+		static LINGO_CONSTEXPR14 void report_failure(ErrorReport& report, size_type source_offset, error::error_code error, error::error_code handler_error) noexcept
+		{
+			// The error handler gave up on the error. Unless it only ran out of buffer space, this point will never be consumed, so report it now
+			if (error != error::error_code::success && handler_error != error::error_code::destination_buffer_too_small)
+			{
+				report.report(source_offset, error);
+			}
 		}
 
-		private:
 		LINGO_WARNINGS_PUSH_AND_DISABLE_MSVC(4702)
 		bool handle_error(source_decode_result_type& result,
 			utility::span<const source_unit_type> source,
@@ -166,7 +354,7 @@ namespace lingo
 			}
 
 			// Attempt to handle the error
-			result = error::strict<source_encoding_type, source_page_type>::handle(result, source, destination);
+			result = source_error_handler_type::handle(result, source, destination);
 			return result.error == error::error_code::success;
 		}
 
@@ -181,7 +369,7 @@ namespace lingo
 			}
 
 			// Attempt to handle the error
-			result = error::strict<destination_encoding_type, destination_page_type>::handle(result, source, destination);
+			result = destination_error_handler_type::handle(result, source, destination);
 			return result.error == error::error_code::success;
 		}
 		LINGO_WARNINGS_POP_MSVC
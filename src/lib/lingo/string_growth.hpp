@@ -0,0 +1,118 @@
+#ifndef H_LINGO_STRING_GROWTH
+#define H_LINGO_STRING_GROWTH
+
+#include <lingo/platform/constexpr.hpp>
+
+#include <cstddef>
+
+namespace lingo
+{
+	// Policies that choose how much memory a basic_string allocates
+	// A policy provides the following functions, that both return a capacity in units:
+	//
+	// // Called when a string with current_capacity needs room for requested_capacity units, the result must lie between requested_capacity and max_capacity
+	// template <typename Unit> static std::size_t grow(std::size_t current_capacity, std::size_t requested_capacity, std::size_t max_capacity, std::size_t extra_units) noexcept;
+	//
+	// // Called by shrink_to_fit for a string of size units, the result must lie between size and max_capacity
+	// template <typename Unit> static std::size_t fit(std::size_t size, std::size_t max_capacity, std::size_t extra_units) noexcept;
+	//
+	// Every allocation holds extra_units units on top of the capacity, for the null terminator and any data the layout stores in front of the string.
+	namespace string_growth
+	{
+		// Multiplies the capacity by Numerator / Denominator, or grows to the requested capacity if that is larger
+		// The default policy doubles the capacity
+		template <std::size_t Numerator = 2, std::size_t Denominator = 1>
+		struct geometric
+		{
+			static_assert(Denominator > 0 && Numerator > Denominator, "the growth factor must be larger than 1");
+
+			template <typename Unit>
+			static std::size_t grow(std::size_t current_capacity, std::size_t requested_capacity, std::size_t max_capacity, std::size_t) noexcept
+			{
+				const std::size_t grown_capacity = current_capacity <= max_capacity / Numerator ? current_capacity * Numerator / Denominator : max_capacity;
+				return grown_capacity > requested_capacity ? grown_capacity : requested_capacity;
+			}
+
+			template <typename Unit>
+			static std::size_t fit(std::size_t size, std::size_t, std::size_t) noexcept
+			{
+				return size;
+			}
+		};
+
+		// Allocates exactly the requested capacity, for strings that rarely grow after they are created
+		struct exact
+		{
+			template <typename Unit>
+			static std::size_t grow(std::size_t, std::size_t requested_capacity, std::size_t, std::size_t) noexcept
+			{
+				return requested_capacity;
+			}
+
+			template <typename Unit>
+			static std::size_t fit(std::size_t size, std::size_t, std::size_t) noexcept
+			{
+				return size;
+			}
+		};
+
+		// Rounds the allocations of another policy up to the size classes of a typical allocator, so that the rounding is usable capacity instead of waste
+		// Allocations of up to 4 * Granularity bytes are rounded up to a multiple of Granularity,
+		// larger allocations are rounded up to the next quarter of a power of two.
+		template <typename Policy = geometric<>, std::size_t Granularity = 16>
+		struct size_classes
+		{
+			static_assert(Granularity > 0 && (Granularity & (Granularity - 1)) == 0, "the granularity must be a power of two");
+
+			template <typename Unit>
+			static std::size_t grow(std::size_t current_capacity, std::size_t requested_capacity, std::size_t max_capacity, std::size_t extra_units) noexcept
+			{
+				return round<Unit>(Policy::template grow<Unit>(current_capacity, requested_capacity, max_capacity, extra_units), max_capacity, extra_units);
+			}
+
+			template <typename Unit>
+			static std::size_t fit(std::size_t size, std::size_t max_capacity, std::size_t extra_units) noexcept
+			{
+				return round<Unit>(Policy::template fit<Unit>(size, max_capacity, extra_units), max_capacity, extra_units);
+			}
+
+			private:
+			template <typename Unit>
+			static std::size_t round(std::size_t capacity, std::size_t max_capacity, std::size_t extra_units) noexcept
+			{
+				// Leave capacities alone that are too close to the maximum to be rounded
+				if (capacity >= max_capacity || capacity > static_cast<std::size_t>(-1) / sizeof(Unit) / 4)
+				{
+					return capacity;
+				}
+
+				const std::size_t size = (capacity + extra_units) * sizeof(Unit);
+
+				// Find the step between the size classes around this size
+				std::size_t step = Granularity;
+				if (size > Granularity * 4)
+				{
+					std::size_t power = Granularity * 4;
+					while (power * 2 < size)
+					{
+						power *= 2;
+					}
+					step = power / 4;
+				}
+
+				const std::size_t rounded_capacity = ((size + step - 1) / step * step) / sizeof(Unit) - extra_units;
+				return rounded_capacity < max_capacity ? rounded_capacity : max_capacity;
+			}
+		};
+	}
+
+	// Selects the growth policy of strings that use Allocator
+	// Specialize this for an allocator to tune how much memory its strings use, for example with string_growth::size_classes for an allocator with known size classes.
+	template <typename Allocator>
+	struct string_growth_traits
+	{
+		using policy_type = string_growth::geometric<>;
+	};
+}
+
+#endif
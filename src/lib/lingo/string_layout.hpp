@@ -0,0 +1,35 @@
+#ifndef H_LINGO_STRING_LAYOUT
+#define H_LINGO_STRING_LAYOUT
+
+#include <cstddef>
+
+namespace lingo
+{
+	// Policies that choose how a basic_string lays out its pointer, size, capacity and small string buffer
+	namespace string_layout
+	{
+		// Four pointers large
+		// Allocated strings store a pointer, their size and their capacity,
+		// short strings store up to (4 * sizeof(void*)) / sizeof(unit) - 1 units without allocating
+		struct standard
+		{
+		};
+
+		// Two pointers large, for containers with many mostly short strings
+		// Allocated strings store a pointer and store their size in the rest of the second pointer,
+		// their capacity is stored in front of the allocated units.
+		// Short strings store up to (2 * sizeof(void*)) / sizeof(unit) - 1 units without allocating, which is 15 units for UTF-8 on 64 bit platforms
+		struct compact
+		{
+		};
+
+		// The standard layout with the small string buffer enlarged to Size bytes,
+		// for strings that are usually just a bit too long to fit inside the standard layout
+		template <std::size_t Size>
+		struct inline_buffer
+		{
+		};
+	}
+}
+
+#endif
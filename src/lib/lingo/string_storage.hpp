@@ -3,15 +3,21 @@
 
 #include <lingo/platform/constexpr.hpp>
 
+#include <lingo/string_growth.hpp>
+#include <lingo/string_layout.hpp>
+
 #include <lingo/utility/compressed_pair.hpp>
 #include <lingo/utility/item_traits.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <cstring>
 #include <limits>
 #include <memory>
+#include <stdexcept>
 #include <type_traits>
+#include <utility>
 
 namespace lingo
 {
@@ -23,33 +29,33 @@ namespace lingo
 			static LINGO_CONSTEXPR11 Unit value = (std::numeric_limits<Unit>::max)();
 		};
 
-		template <typename Unit>
+		template <typename Unit, std::size_t Size>
 		struct basic_string_storage_short_marker
 		{
-			static LINGO_CONSTEXPR11 Unit value = Unit(((sizeof(void*) * 4) / sizeof(Unit)) - 1);
+			static LINGO_CONSTEXPR11 Unit value = Unit((Size / sizeof(Unit)) - 1);
 		};
 
-		template <typename Unit>
+		template <typename Unit, std::size_t Size>
 		struct basic_string_storage_data_requires_padding
 		{
-			static LINGO_CONSTEXPR11 bool value = sizeof(Unit) < sizeof(void*);
+			static LINGO_CONSTEXPR11 bool value = Size > sizeof(Unit*) + sizeof(std::size_t) * 2 + sizeof(Unit);
 		};
 
-		template <typename Unit, bool Padding = basic_string_storage_data_requires_padding<Unit>::value>
+		template <typename Unit, std::size_t Size, bool Padding = basic_string_storage_data_requires_padding<Unit, Size>::value>
 		struct basic_string_storage_data_long;
 
-		template <typename Unit>
-		struct basic_string_storage_data_long<Unit, true>
+		template <typename Unit, std::size_t Size>
+		struct basic_string_storage_data_long<Unit, Size, true>
 		{
 			Unit* _data;
 			std::size_t _size;
 			std::size_t _capacity;
-			char _padding[sizeof(void*) - sizeof(Unit)];
+			char _padding[Size - sizeof(Unit*) - sizeof(std::size_t) * 2 - sizeof(Unit)];
 			Unit _last_unit;
 		};
 
-		template <typename Unit>
-		struct basic_string_storage_data_long<Unit, false>
+		template <typename Unit, std::size_t Size>
+		struct basic_string_storage_data_long<Unit, Size, false>
 		{
 			Unit* _data;
 			std::size_t _size;
@@ -57,37 +63,176 @@ namespace lingo
 			Unit _last_unit;
 		};
 
+		// The size is stored in the bytes between the pointer and the last unit
 		template <typename Unit>
+		struct basic_string_storage_data_compact_long
+		{
+			Unit* _data;
+			unsigned char _size[sizeof(void*) - sizeof(Unit)];
+			Unit _last_unit;
+		};
+
+		template <typename Unit, std::size_t Size>
 		struct basic_string_storage_data_short
 		{
-			Unit _data[(sizeof(void*) * 4) / sizeof(Unit) - 1];
+			Unit _data[Size / sizeof(Unit) - 1];
 			Unit _last_unit;
 		};
 
-		template <typename Unit>
+		template <typename Unit, typename Long, std::size_t Size>
 		union basic_string_storage_data
 		{
 			basic_string_storage_data() noexcept
 			{
 				_short._data[0] = {};
-				_short._last_unit = basic_string_storage_short_marker<Unit>::value;
+				_short._last_unit = basic_string_storage_short_marker<Unit, Size>::value;
 			}
 
-			basic_string_storage_data_long<Unit> _long;
-			basic_string_storage_data_short<Unit> _short;
+			Long _long;
+			basic_string_storage_data_short<Unit, Size> _short;
 		};
 
-		static_assert(sizeof(basic_string_storage_data<uint_least8_t>) == sizeof(void*) * 4, "string storage is the correct size");
-		static_assert(sizeof(basic_string_storage_data<uint_least16_t>) == sizeof(void*) * 4, "string storage is the correct size");
-		static_assert(sizeof(basic_string_storage_data<uint_least32_t>) == sizeof(void*) * 4, "string storage is the correct size");
-		static_assert(sizeof(basic_string_storage_data<uint_least64_t>) == sizeof(void*) * 4 || sizeof(uint_least64_t) > sizeof(void*), "string storage is the correct size");
+		// Layouts that store the size and capacity of allocated strings next to the pointer
+		template <typename Unit, std::size_t Size>
+		struct basic_string_storage_inline_layout
+		{
+			static_assert(Size % sizeof(void*) == 0, "the string storage must be a multiple of the pointer size");
+			static_assert(Size / sizeof(Unit) - 1 < static_cast<std::size_t>((std::numeric_limits<Unit>::max)()), "the small string capacity must be storable in a single unit");
+
+			using data_type = basic_string_storage_data<Unit, basic_string_storage_data_long<Unit, Size>, Size>;
+
+			static LINGO_CONSTEXPR11 const std::size_t short_capacity = Size / sizeof(Unit) - 1;
+			static LINGO_CONSTEXPR11 const std::size_t header_units = 0;
+
+			static std::size_t max_size() noexcept
+			{
+				return (std::numeric_limits<std::size_t>::max)();
+			}
+
+			static std::size_t long_size(const data_type& data) noexcept
+			{
+				return data._long._size;
+			}
+
+			static void set_long_size(data_type& data, std::size_t size) noexcept
+			{
+				data._long._size = size;
+			}
+
+			static std::size_t long_capacity(const data_type& data) noexcept
+			{
+				return data._long._capacity;
+			}
+
+			static void set_long(data_type& data, Unit* units, std::size_t capacity) noexcept
+			{
+				data._long._data = units;
+				data._long._capacity = capacity;
+				data._long._last_unit = basic_string_storage_long_marker<Unit>::value;
+			}
+		};
+
+		template <typename Unit, std::size_t Size>
+		LINGO_CONSTEXPR11 const std::size_t basic_string_storage_inline_layout<Unit, Size>::short_capacity;
+
+		template <typename Unit, std::size_t Size>
+		LINGO_CONSTEXPR11 const std::size_t basic_string_storage_inline_layout<Unit, Size>::header_units;
+
+		// A layout of two pointers, that moves the capacity of allocated strings into the allocation itself
+		template <typename Unit>
+		struct basic_string_storage_compact_layout
+		{
+			static_assert(sizeof(Unit) < sizeof(void*), "the compact string layout requires units that are smaller than a pointer");
+
+			using long_type = basic_string_storage_data_compact_long<Unit>;
+			using data_type = basic_string_storage_data<Unit, long_type, sizeof(void*) * 2>;
+
+			static LINGO_CONSTEXPR11 const std::size_t short_capacity = (sizeof(void*) * 2) / sizeof(Unit) - 1;
+
+			// The capacity is stored in the units in front of the string
+			static LINGO_CONSTEXPR11 const std::size_t header_units = (sizeof(std::size_t) + sizeof(Unit) - 1) / sizeof(Unit);
+
+			static std::size_t max_size() noexcept
+			{
+				return (std::size_t(1) << (std::numeric_limits<unsigned char>::digits * sizeof(long_type::_size))) - 1;
+			}
+
+			static std::size_t long_size(const data_type& data) noexcept
+			{
+				std::size_t size = 0;
+				for (std::size_t i = 0; i < sizeof(long_type::_size); ++i)
+				{
+					size |= static_cast<std::size_t>(data._long._size[i]) << (std::numeric_limits<unsigned char>::digits * i);
+				}
+				return size;
+			}
+
+			static void set_long_size(data_type& data, std::size_t size) noexcept
+			{
+				assert(size <= max_size());
+				for (std::size_t i = 0; i < sizeof(long_type::_size); ++i)
+				{
+					data._long._size[i] = static_cast<unsigned char>(size >> (std::numeric_limits<unsigned char>::digits * i));
+				}
+			}
+
+			static std::size_t long_capacity(const data_type& data) noexcept
+			{
+				std::size_t capacity;
+				std::memcpy(&capacity, data._long._data - header_units, sizeof(capacity));
+				return capacity;
+			}
+
+			static void set_long(data_type& data, Unit* units, std::size_t capacity) noexcept
+			{
+				std::memcpy(units - header_units, &capacity, sizeof(capacity));
+				data._long._data = units;
+				data._long._last_unit = basic_string_storage_long_marker<Unit>::value;
+			}
+		};
+
+		template <typename Unit>
+		LINGO_CONSTEXPR11 const std::size_t basic_string_storage_compact_layout<Unit>::short_capacity;
+
+		template <typename Unit>
+		LINGO_CONSTEXPR11 const std::size_t basic_string_storage_compact_layout<Unit>::header_units;
+
+		template <typename Unit, typename Layout>
+		struct basic_string_storage_layout;
+
+		template <typename Unit>
+		struct basic_string_storage_layout<Unit, string_layout::standard> : basic_string_storage_inline_layout<Unit, sizeof(void*) * 4>
+		{
+		};
+
+		template <typename Unit>
+		struct basic_string_storage_layout<Unit, string_layout::compact> : basic_string_storage_compact_layout<Unit>
+		{
+		};
+
+		template <typename Unit, std::size_t Size>
+		struct basic_string_storage_layout<Unit, string_layout::inline_buffer<Size>> : basic_string_storage_inline_layout<Unit, Size>
+		{
+			static_assert(Size >= sizeof(void*) * 4, "the inline buffer must be at least as large as the standard layout");
+		};
+
+		static_assert(sizeof(basic_string_storage_layout<uint_least8_t, string_layout::standard>::data_type) == sizeof(void*) * 4, "string storage is the correct size");
+		static_assert(sizeof(basic_string_storage_layout<uint_least16_t, string_layout::standard>::data_type) == sizeof(void*) * 4, "string storage is the correct size");
+		static_assert(sizeof(basic_string_storage_layout<uint_least32_t, string_layout::standard>::data_type) == sizeof(void*) * 4, "string storage is the correct size");
+		static_assert(sizeof(basic_string_storage_layout<uint_least64_t, string_layout::standard>::data_type) == sizeof(void*) * 4 || sizeof(uint_least64_t) > sizeof(void*), "string storage is the correct size");
+		static_assert(sizeof(basic_string_storage_layout<uint_least8_t, string_layout::compact>::data_type) == sizeof(void*) * 2, "string storage is the correct size");
+		static_assert(sizeof(basic_string_storage_layout<uint_least16_t, string_layout::compact>::data_type) == sizeof(void*) * 2, "string storage is the correct size");
+		static_assert(sizeof(basic_string_storage_layout<uint_least8_t, string_layout::inline_buffer<64>>::data_type) == 64, "string storage is the correct size");
+		static_assert(sizeof(basic_string_storage_layout<uint_least32_t, string_layout::inline_buffer<64>>::data_type) == 64, "string storage is the correct size");
 	}
 
-	template <typename Unit, typename Allocator = std::allocator<Unit>>
+	template <typename Unit, typename Allocator = std::allocator<Unit>, typename Layout = string_layout::standard, typename Growth = typename string_growth_traits<Allocator>::policy_type>
 	class basic_string_storage 
 	{
 		public:
 		using allocator_type = Allocator;
+		using layout_type = Layout;
+		using growth_type = Growth;
 
 		using unit_type = Unit;
 
@@ -97,19 +242,22 @@ namespace lingo
 		using pointer = value_type*;
 		using const_pointer = const value_type*;
 
-		using size_type = typename allocator_type::size_type;
-		using difference_type = typename allocator_type::difference_type;
+		using size_type = typename std::allocator_traits<allocator_type>::size_type;
+		using difference_type = typename std::allocator_traits<allocator_type>::difference_type;
 
 		static_assert(std::is_same<unit_type, typename allocator_type::value_type>::value, "allocator_type::value_type must be the same type as basic_string_storage::unit_type");
 
 		private:
-		using compressed_pair = utility::compressed_pair<internal::basic_string_storage_data<unit_type>, allocator_type>;
+		using layout = internal::basic_string_storage_layout<unit_type, layout_type>;
+		using compressed_pair = utility::compressed_pair<typename layout::data_type, allocator_type>;
+		using allocator_traits = std::allocator_traits<allocator_type>;
 
 		using construct_items = utility::construct_items<value_type>;
 		using copy_items = utility::copy_items<value_type>;
 		using move_items = utility::move_items<value_type>;
 		using destruct_items = utility::destruct_items<value_type>;
 		using destructive_move_items = utility::destructive_move_items<value_type>;
+		using destructive_move_overlapping_items = utility::destructive_move_overlapping_items<value_type>;
 
 		struct allocation
 		{
@@ -140,7 +288,7 @@ namespace lingo
 			basic_string_storage(allocator)
 		{
 			// Move memory if it can be shared between allocators
-			if (allocator == storage.get_allocator())
+			if (_data.second() == storage._data.second())
 			{
 				// Move memory if it was allocated dynamically
 				if (storage.is_long())
@@ -150,7 +298,7 @@ namespace lingo
 					set_size(storage.size());
 
 					// Reset source
-					storage._data.first()._short = {};
+					storage.reset_data();
 				}
 				// Small string optimized memory cannot be moved, so we still need to copy it
 				else
@@ -201,28 +349,28 @@ namespace lingo
 		{
 			if (is_long())
 			{
-				return _data.first()._long._size;
+				return layout::long_size(_data.first());
 			}
 			else
 			{
-				return ((sizeof(void*) * 4) / sizeof(value_type)) - (static_cast<size_type>(_data.first()._short._last_unit) + 1);
+				return layout::short_capacity - static_cast<size_type>(_data.first()._short._last_unit);
 			}
 		}
 
 		size_type max_size() const noexcept
 		{
-			return (std::numeric_limits<size_t>::max)();
+			return layout::max_size();
 		}
 
 		size_type capacity() const noexcept
 		{
 			if (is_long())
 			{
-				return _data.first()._long._capacity;
+				return layout::long_capacity(_data.first());
 			}
 			else
 			{
-				return (sizeof(internal::basic_string_storage_data<value_type>) / sizeof(value_type)) - 1;
+				return layout::short_capacity;
 			}
 		}
 
@@ -319,6 +467,137 @@ namespace lingo
 			}
 		}
 
+		// Grow while keeping only the first kept_size units, everything after them including the null terminator is destructed
+		// The caller has to construct the new units and the null terminator, and update the size
+		void grow_uninitialized(size_type new_capacity, size_type kept_size)
+		{
+			assert(kept_size <= size() && kept_size <= new_capacity);
+
+			const allocation current_alloc = current_allocation();
+			const auto alloc = allocate(new_capacity);
+
+			// Current allocation is already big enough, so we only need to remove the discarded units
+			if (current_alloc.data == alloc.data)
+			{
+				destruct_items{}(data() + kept_size, size() - kept_size + 1);
+			}
+			// New buffer has been allocated
+			else
+			{
+				try
+				{
+					// Move the kept data over to the new buffer
+					destructive_move_items{}(alloc.data, current_alloc.data, kept_size);
+
+					// Destruct the discarded units and the null terminator
+					destruct_items{}(current_alloc.data + kept_size, size() - kept_size + 1);
+
+					// Swap allocations
+					swap_data(alloc);
+				}
+				catch (...)
+				{
+					if (alloc.data != current_alloc.data)
+					{
+						free(alloc);
+					}
+					throw;
+				}
+			}
+		}
+
+		// Replaces the removed_count units at pos with inserted_count units, keeping the units before and after them and the null terminator
+		// The inserted units are left uninitialized, the caller has to construct them. The size is updated to the new size.
+		// If the current allocation is big enough, the units behind the replaced units are moved with a single memmove.
+		// Otherwise a single new buffer is allocated, and the units before and after the gap are moved straight to their final position.
+		void grow_move(size_type pos, size_type removed_count, size_type inserted_count)
+		{
+			const size_type original_size = size();
+			assert(pos <= original_size && removed_count <= original_size - pos);
+
+			if (inserted_count > max_size() - (original_size - removed_count))
+			{
+				throw std::length_error("basic_string is too large");
+			}
+
+			const size_type tail_size = original_size - pos - removed_count + 1;
+			const size_type new_size = original_size - removed_count + inserted_count;
+
+			const allocation current_alloc = current_allocation();
+			const auto alloc = allocate(new_size);
+
+			// Current allocation is already big enough, so the units only have to shift
+			if (current_alloc.data == alloc.data)
+			{
+				destruct_items{}(current_alloc.data + pos, removed_count);
+				if (removed_count != inserted_count)
+				{
+					destructive_move_overlapping_items{}(current_alloc.data + pos + inserted_count, current_alloc.data + pos + removed_count, tail_size);
+				}
+			}
+			// New buffer has been allocated
+			else
+			{
+				try
+				{
+					// Move the units around the gap over to the new buffer
+					destructive_move_items{}(alloc.data, current_alloc.data, pos);
+					destruct_items{}(current_alloc.data + pos, removed_count);
+					destructive_move_items{}(alloc.data + pos + inserted_count, current_alloc.data + pos + removed_count, tail_size);
+
+					// Swap allocations
+					swap_data(alloc);
+				}
+				catch (...)
+				{
+					if (alloc.data != current_alloc.data)
+					{
+						free(alloc);
+					}
+					throw;
+				}
+			}
+
+			set_size(new_size);
+		}
+
+		// Moves the units into the smallest buffer that fits them, which is the small string buffer if they fit in there
+		void shrink_to_fit()
+		{
+			if (!is_long())
+			{
+				return;
+			}
+
+			const allocation current_alloc = current_allocation();
+			const size_type current_size = size();
+
+			// Move back into the small string buffer
+			if (current_size <= layout::short_capacity)
+			{
+				reset_data();
+				destructive_move_items{}(_data.first()._short._data, current_alloc.data, current_size + 1);
+				set_size(current_size);
+				free(current_alloc);
+				return;
+			}
+
+			// Only reallocate if the policy gives a smaller buffer
+			const size_type new_capacity = growth_type::template fit<unit_type>(current_size, max_size(), layout::header_units + 1);
+			assert(new_capacity >= current_size && new_capacity <= max_size());
+			if (new_capacity >= capacity())
+			{
+				return;
+			}
+
+			allocation alloc;
+			alloc.size = new_capacity + 1;
+			alloc.data = allocator_traits::allocate(_data.second(), alloc.size + layout::header_units) + layout::header_units;
+			destructive_move_items{}(alloc.data, current_alloc.data, current_size + 1);
+			swap_data(alloc);
+			set_size(current_size);
+		}
+
 		void assign(const_pointer str, size_type length)
 		{
 			assert(length <= capacity());
@@ -354,9 +633,8 @@ namespace lingo
 		{
 			if (&storage != this)
 			{
-				grow_discard(storage.size());
-				copy_items{}(data(), storage.data(), storage.size() + 1);
-				set_size(storage.size());
+				propagate_allocator(storage._data.second(), typename allocator_traits::propagate_on_container_copy_assignment());
+				copy_data(storage);
 			}
 			return *this;
 		}
@@ -365,43 +643,52 @@ namespace lingo
 		{
 			if (&storage != this)
 			{
-				// Move memory if it can be shared between allocators
-				if (get_allocator() == storage.get_allocator())
+				// Move memory if it can be shared between allocators, or if the allocator moves along with it
+				if (allocator_traits::propagate_on_container_move_assignment::value || _data.second() == storage._data.second())
 				{
 					// Move memory if it was allocated dynamically
 					if (storage.is_long())
 					{
-						// Destruct existing data if it exists
-						if (is_long())
-						{
-							destruct_items{}(data(), size() + 1);
-						}
+						// Release existing data with the allocator that allocated it
+						release();
+						propagate_allocator(storage._data.second(), typename allocator_traits::propagate_on_container_move_assignment());
 
 						// Copy allocation from source
 						swap_data(storage.current_allocation());
 						set_size(storage.size());
 
 						// Mark source as empty
-						storage._data.first()._short = {};
+						storage.reset_data();
 					}
 					// Small string optimized memory cannot be moved, so we still need to copy it
 					else
 					{
-						(*this) = static_cast<const basic_string_storage&>(storage);
+						propagate_allocator(storage._data.second(), typename allocator_traits::propagate_on_container_move_assignment());
+						copy_data(storage);
 					}
 				}
 				// Allocators cannot share memory, so we have to copy
 				else
 				{
-					(*this) = static_cast<const basic_string_storage&>(storage);
+					copy_data(storage);
 				}
 			}
 			return *this;
 		}
 
-		allocation allocate(size_type requested_capacity) noexcept(noexcept(std::declval<allocator_type&>().allocate(requested_capacity)))
+		void swap(basic_string_storage& storage) noexcept
+		{
+			swap_allocator(storage, typename allocator_traits::propagate_on_container_swap());
+			std::swap(_data.first(), storage._data.first());
+		}
+
+		// Throws std::length_error if the layout can not store requested_capacity units, the compact layout can only store a limited size
+		allocation allocate(size_type requested_capacity)
 		{
-			assert(requested_capacity <= max_size());
+			if (requested_capacity > max_size())
+			{
+				throw std::length_error("basic_string is too large");
+			}
 
 			// Don't do anything when there is already enough capacity
 			size_type new_capacity = capacity();
@@ -411,20 +698,13 @@ namespace lingo
 			}
 
 			// Calculate the new capacity
-			if (new_capacity * 2 >= requested_capacity)
-			{
-				new_capacity *= 2;
-			}
-			else
-			{
-				new_capacity = requested_capacity;
-			}
+			new_capacity = growth_type::template grow<unit_type>(new_capacity, requested_capacity, max_size(), layout::header_units + 1);
+			assert(new_capacity >= requested_capacity && new_capacity <= max_size());
 
 			// Allocate a new buffer
-			allocator_type allocator = get_allocator();
 			allocation alloc;
 			alloc.size = new_capacity + 1;
-			alloc.data = allocator.allocate(alloc.size);
+			alloc.data = allocator_traits::allocate(_data.second(), alloc.size + layout::header_units) + layout::header_units;
 			return alloc;
 		}
 
@@ -432,9 +712,74 @@ namespace lingo
 		{
 			if (is_long_allocation(alloc))
 			{
-				allocator_type allocator = get_allocator();
-				allocator.deallocate(alloc.data, alloc.size);
+				allocator_traits::deallocate(_data.second(), alloc.data - layout::header_units, alloc.size + layout::header_units);
+			}
+		}
+
+		// Destructs all data and frees the allocation, which leaves the storage as an empty short string
+		void release() noexcept
+		{
+			destruct_items{}(data(), size() + 1);
+			free(current_allocation());
+			reset_data();
+		}
+
+		// Takes over a buffer of capacity + 1 units that was allocated by allocator, and writes the null terminator behind the first size units
+		// The buffer is only adopted if this storage can free it, otherwise its units are copied and the buffer is freed right away
+		void adopt(pointer units, size_type size, size_type capacity, const allocator_type& allocator)
+		{
+			static_assert(layout::header_units == 0, "buffers can only be adopted by layouts that store the capacity inside the string");
+			assert(size <= capacity && capacity <= max_size());
+
+			// Adopt the buffer if the allocator can free it, or if the allocator moves along with it
+			if (allocator_traits::propagate_on_container_move_assignment::value || _data.second() == allocator)
+			{
+				release();
+				propagate_allocator(allocator, typename allocator_traits::propagate_on_container_move_assignment());
+
+				LINGO_CONSTEXPR11 const value_type null_terminator{};
+				copy_items{}(units + size, &null_terminator, 1);
+				layout::set_long(_data.first(), units, capacity);
+				set_size(size);
+			}
+			// Allocators cannot share memory, so we have to copy
+			else
+			{
+				allocator_type buffer_allocator(allocator);
+				try
+				{
+					grow_discard(size);
+					assign(units, size);
+				}
+				catch (...)
+				{
+					destruct_items{}(units, size);
+					allocator_traits::deallocate(buffer_allocator, units, capacity + 1);
+					throw;
+				}
+
+				destruct_items{}(units, size);
+				allocator_traits::deallocate(buffer_allocator, units, capacity + 1);
+			}
+		}
+
+		// Hands the allocation over to the caller, and leaves the storage as an empty short string
+		// Short strings are copied into a new allocation first, so the result is always allocated by get_allocator() and null terminated
+		// The size of the returned allocation includes the null terminator, just like current_allocation()
+		allocation release_allocation()
+		{
+			static_assert(layout::header_units == 0, "buffers can only be released by layouts that store the capacity inside the string");
+
+			allocation alloc = current_allocation();
+			if (!is_long())
+			{
+				alloc.size = size() + 1;
+				alloc.data = allocator_traits::allocate(_data.second(), alloc.size);
+				destructive_move_items{}(alloc.data, data(), alloc.size);
 			}
+
+			reset_data();
+			return alloc;
 		}
 
 		void swap_data(allocation alloc) noexcept
@@ -455,10 +800,7 @@ namespace lingo
 			}
 
 			// Replace the old data pointers with the new ones
-			auto& long_storage = _data.first()._long;
-			long_storage._data = alloc.data;
-			long_storage._capacity = alloc.size - 1;
-			long_storage._last_unit = internal::basic_string_storage_long_marker<value_type>::value;
+			layout::set_long(_data.first(), alloc.data, alloc.size - 1);
 		}
 
 		bool is_long_allocation(allocation alloc) noexcept
@@ -476,15 +818,55 @@ namespace lingo
 			assert(new_size <= capacity());
 			if (is_long())
 			{
-				_data.first()._long._size = new_size;
+				layout::set_long_size(_data.first(), new_size);
 			}
 			else
 			{
-				_data.first()._short._last_unit = static_cast<value_type>(internal::basic_string_storage_short_marker<Unit>::value - new_size);
+				_data.first()._short._last_unit = static_cast<value_type>(layout::short_capacity - new_size);
 			}
 		}
 
 		private:
+		void reset_data() noexcept
+		{
+			_data.first() = typename layout::data_type();
+		}
+
+		void copy_data(const basic_string_storage& storage)
+		{
+			grow_discard(storage.size());
+			copy_items{}(data(), storage.data(), storage.size() + 1);
+			set_size(storage.size());
+		}
+
+		// Memory can only be freed by an allocator that compares equal to the one that allocated it,
+		// so the data has to be released before a different allocator is propagated
+		void propagate_allocator(const allocator_type& allocator, std::true_type)
+		{
+			if (_data.second() != allocator)
+			{
+				release();
+			}
+			_data.second() = allocator;
+		}
+
+		void propagate_allocator(const allocator_type&, std::false_type) noexcept
+		{
+		}
+
+		void swap_allocator(basic_string_storage& storage, std::true_type) noexcept
+		{
+			using std::swap;
+			swap(_data.second(), storage._data.second());
+		}
+
+		void swap_allocator(basic_string_storage& storage, std::false_type) noexcept
+		{
+			// Swapping strings with allocators that do not propagate and cannot share memory is undefined, just like for std::basic_string
+			assert(_data.second() == storage._data.second());
+			static_cast<void>(storage);
+		}
+
 		compressed_pair _data;
 	};
 
@@ -492,6 +874,9 @@ namespace lingo
 	static_assert(sizeof(basic_string_storage<uint_least16_t>) == sizeof(void*) * 4, "string storage is the correct size");
 	static_assert(sizeof(basic_string_storage<uint_least32_t>) == sizeof(void*) * 4, "string storage is the correct size");
 	static_assert(sizeof(basic_string_storage<uint_least64_t>) == sizeof(void*) * 4 || sizeof(uint_least64_t) > sizeof(void*), "string storage is the correct size");
+	static_assert(sizeof(basic_string_storage<uint_least8_t, std::allocator<uint_least8_t>, string_layout::compact>) == sizeof(void*) * 2, "string storage is the correct size");
+	static_assert(sizeof(basic_string_storage<uint_least16_t, std::allocator<uint_least16_t>, string_layout::compact>) == sizeof(void*) * 2, "string storage is the correct size");
+	static_assert(sizeof(basic_string_storage<uint_least8_t, std::allocator<uint_least8_t>, string_layout::inline_buffer<64>>) == 64, "string storage is the correct size");
 }
 
 #endif
\ No newline at end of file
@@ -4,16 +4,27 @@
 #include <lingo/platform/constexpr.hpp>
 
 #include <lingo/null_terminated_string.hpp>
+#include <lingo/point_set.hpp>
+#include <lingo/string_converter.hpp>
 #include <lingo/string_view_storage.hpp>
 #include <lingo/strlen.hpp>
 
 #include <lingo/page/execution.hpp>
+#include <lingo/page/intermediate.hpp>
+#include <lingo/page/point_mapper.hpp>
 
+#include <lingo/encoding/ascii_units.hpp>
 #include <lingo/encoding/execution.hpp>
 #include <lingo/encoding/point_iterator.hpp>
+#include <lingo/encoding/decode_back.hpp>
+#include <lingo/encoding/unit_order.hpp>
+
+#include <lingo/error/exception.hpp>
+#include <lingo/error/stop.hpp>
 
 #include <lingo/utility/item_traits.hpp>
 #include <lingo/utility/pointer_iterator.hpp>
+#include <lingo/utility/search.hpp>
 #include <lingo/utility/type_traits.hpp>
 
 #include <algorithm>
@@ -60,6 +71,7 @@ namespace lingo
 		static_assert(std::is_same<typename page_type::point_type, typename encoding_type::point_type>::value, "page_type::point_type must be the same type as encoding_type::point_type");\
 
 		using point_iterator = encoding::point_iterator<encoding_type>;
+		using search_point_iterator = encoding::point_iterator<encoding_type, error::stop<encoding_type, page_type>>;
 		using storage_type = basic_string_view_storage<value_type>;
 
 		using construct_items = utility::construct_items<value_type>;
@@ -320,45 +332,9 @@ namespace lingo
 			_storage.swap(other._storage);
 		}
 
-		LINGO_CONSTEXPR14 int compare(basic_string_view other) const
+		LINGO_CONSTEXPR14 int compare(basic_string_view other) const noexcept(encoding::has_unit_order<encoding_type>::value || point_iterator::is_nothrow)
 		{
-			point_iterator left(*this);
-			point_iterator right(other);
-			const point_iterator end;
-
-			for (; left != end && right != end; ++left, ++right)
-			{
-				const auto left_point = *left;
-				const auto right_point = *right;
-
-				if (left_point != right_point)
-				{
-					if (left_point < right_point)
-					{
-						return -1;
-					}
-					else
-					{
-						return 1;
-					}
-				}
-			}
-
-			if ((left == end) != (right == end))
-			{
-				if (left == end)
-				{
-					return -1;
-				}
-				else
-				{
-					return 1;
-				}
-			}
-			else
-			{
-				return 0;
-			}
+			return compare_ordered(other, encoding::has_unit_order<encoding_type>());
 		}
 
 		template <typename _ = int, typename std::enable_if<is_execution_set, _>::type = 0>
@@ -375,6 +351,65 @@ namespace lingo
 		}
 		#endif
 
+		// Compares with a string of another encoding or page without converting either of them
+		// Points of different pages are compared after mapping both to their intermediate page
+		// Throws error::exception if either string contains an invalid point, or a point that can not be mapped
+		template <typename OtherEncoding, typename OtherPage, typename std::enable_if<
+			!std::is_same<OtherEncoding, encoding_type>::value || !std::is_same<OtherPage, page_type>::value, int>::type = 0>
+		int compare(basic_string_view<OtherEncoding, OtherPage> other) const
+		{
+			using other_unit_key_type = typename std::make_unsigned<typename OtherEncoding::unit_type>::type;
+			using comparison_page_type = typename std::conditional<std::is_same<OtherPage, page_type>::value, page_type, page::intermediate_t<page_type, OtherPage>>::type;
+
+			// Encodings that store ASCII as single units can compare runs of ASCII directly if the points mean the same
+			LINGO_CONSTEXPR11 const bool compare_ascii_units =
+				std::is_same<OtherPage, page_type>::value &&
+				encoding::has_ascii_units<encoding_type>::value &&
+				encoding::has_ascii_units<OtherEncoding>::value;
+
+			size_type left = 0;
+			size_type right = 0;
+			while (left < size() && right < other.size())
+			{
+				LINGO_IF_CONSTEXPR(compare_ascii_units)
+				{
+					const unit_key_type left_key = static_cast<unit_key_type>(data()[left]);
+					const other_unit_key_type right_key = static_cast<other_unit_key_type>(other.data()[right]);
+					if (left_key < 0x80 && right_key < 0x80)
+					{
+						if (left_key != right_key)
+						{
+							return left_key < right_key ? -1 : 1;
+						}
+
+						++left;
+						++right;
+						continue;
+					}
+				}
+
+				const auto left_point = decode_comparison_point<comparison_page_type>(*this, left);
+				const auto right_point = decode_comparison_point<comparison_page_type>(other, right);
+				if (left_point != right_point)
+				{
+					return left_point < right_point ? -1 : 1;
+				}
+			}
+
+			if (left < size())
+			{
+				return 1;
+			}
+			else if (right < other.size())
+			{
+				return -1;
+			}
+			else
+			{
+				return 0;
+			}
+		}
+
 		template <typename _ = int, typename std::enable_if<is_execution_set, _>::type = 0>
 		LINGO_CONSTEXPR14 size_type find(const_pointer str) const noexcept
 		{
@@ -425,20 +460,25 @@ namespace lingo
 				return npos;
 			}
 
-			const auto text_begin = begin() + pos;
-			const auto text_end = end();
-			const auto pattern_begin = str.begin();
-			const auto pattern_end = str.end();
-
-			const auto find_result = naive_find(text_begin, text_end, pattern_begin, pattern_end);
-			if (find_result != text_end)
-			{
-				return static_cast<size_type>(find_result.get() - data());
-			}
-			else
+			while (pos + str.size() <= size())
 			{
-				return npos;
+				const size_type result = utility::search_items(data() + pos, size() - pos, str.data(), str.size());
+				if (result == utility::not_found)
+				{
+					return npos;
+				}
+
+				// Only matches that start at the beginning of a point count
+				pos += result;
+				if (is_point_boundary(pos, encoding::has_decode_back<encoding_type>()))
+				{
+					return pos;
+				}
+
+				++pos;
 			}
+
+			return npos;
 		}
 
 		template <typename T,
@@ -508,26 +548,32 @@ namespace lingo
 
 		LINGO_CONSTEXPR14 size_type rfind(basic_string_view str, size_type pos) const noexcept
 		{
+			// Matches have to end at or before pos
 			pos = (std::min)(pos, size() - 1);
 			if (str.size() > pos + 1)
 			{
 				return npos;
 			}
 
-			const auto text_begin = rend() - (pos + 1);
-			const auto text_end = rend();
-			const auto pattern_begin = str.rbegin();
-			const auto pattern_end = str.rend();
-
-			const auto find_result = naive_find(text_begin, text_end, pattern_begin, pattern_end);
-			if (find_result != text_end)
+			size_type text_size = pos + 1;
+			while (str.size() <= text_size)
 			{
-				return static_cast<size_type>(find_result.base().get() - data()) - str.length();
-			}
-			else
-			{
-				return npos;
+				const size_type result = utility::search_items_reverse(data(), text_size, str.data(), str.size());
+				if (result == utility::not_found)
+				{
+					return npos;
+				}
+
+				// Only matches that start at the beginning of a point count
+				if (is_point_boundary(result, encoding::has_decode_back<encoding_type>()))
+				{
+					return result;
+				}
+
+				text_size = result + str.size() - 1;
 			}
+
+			return npos;
 		}
 
 		template <typename T,
@@ -552,6 +598,87 @@ namespace lingo
 			return rfind(basic_string_view(str), pos);
 		}
 
+		// The find_first_of family searches for points instead of units
+		// pos must be the offset of the start of a point, and the result is the offset of the start of the found point
+		// The search stops at the first invalid point
+		size_type find_first_of(const point_set<point_type>& points, size_type pos = 0) const noexcept
+		{
+			return find_first_point(points, pos, true);
+		}
+
+		size_type find_first_of(basic_string_view str, size_type pos = 0) const
+		{
+			return find_first_of(make_point_set(str), pos);
+		}
+
+		size_type find_first_not_of(const point_set<point_type>& points, size_type pos = 0) const noexcept
+		{
+			return find_first_point(points, pos, false);
+		}
+
+		size_type find_first_not_of(basic_string_view str, size_type pos = 0) const
+		{
+			return find_first_not_of(make_point_set(str), pos);
+		}
+
+		size_type find_last_of(const point_set<point_type>& points, size_type pos = npos) const noexcept
+		{
+			return find_last_point(points, pos, true);
+		}
+
+		size_type find_last_of(basic_string_view str, size_type pos = npos) const
+		{
+			return find_last_of(make_point_set(str), pos);
+		}
+
+		size_type find_last_not_of(const point_set<point_type>& points, size_type pos = npos) const noexcept
+		{
+			return find_last_point(points, pos, false);
+		}
+
+		size_type find_last_not_of(basic_string_view str, size_type pos = npos) const
+		{
+			return find_last_not_of(make_point_set(str), pos);
+		}
+
+		// Finds a string of another encoding or page by converting it to this encoding once, and searching for the converted string
+		// Strings that contain invalid points, or points that do not exist in this page, are never found
+		template <typename OtherEncoding, typename OtherPage, typename std::enable_if<
+			!std::is_same<OtherEncoding, encoding_type>::value || !std::is_same<OtherPage, page_type>::value, int>::type = 0>
+		size_type find(basic_string_view<OtherEncoding, OtherPage> str, size_type pos = 0) const
+		{
+			const basic_string_view& self = *this;
+			return search_converted(str, [&](basic_string_view converted)
+			{
+				return self.find(converted, pos);
+			});
+		}
+
+		template <typename OtherEncoding, typename OtherPage, typename std::enable_if<
+			!std::is_same<OtherEncoding, encoding_type>::value || !std::is_same<OtherPage, page_type>::value, int>::type = 0>
+		size_type rfind(basic_string_view<OtherEncoding, OtherPage> str, size_type pos = npos) const
+		{
+			const basic_string_view& self = *this;
+			return search_converted(str, [&](basic_string_view converted)
+			{
+				return self.rfind(converted, pos);
+			});
+		}
+
+		// Returns the index of the point that starts at unit offset pos, or the amount of points if pos is the size of the string
+		size_type point_index(size_type pos) const noexcept
+		{
+			const unit_type* const target = data() + (std::min)(pos, size());
+
+			size_type index = 0;
+			for (search_point_iterator it(*this), last; it != last && it.read_ptr() < target; ++it)
+			{
+				++index;
+			}
+
+			return index;
+		}
+
 		LINGO_CONSTEXPR14 bool starts_with(basic_string_view str) const noexcept
 		{
 			if (size() < str.size())
@@ -619,30 +746,303 @@ namespace lingo
 		LINGO_CONSTEXPR14 basic_string_view& operator = (const basic_string_view&) noexcept = default;
 		LINGO_CONSTEXPR14 basic_string_view& operator = (basic_string_view&&) noexcept = default;
 
+		protected:
+		// Compares the units directly, see encoding::unit_order
+		LINGO_CONSTEXPR14 int compare_ordered(basic_string_view other, std::true_type) const noexcept
+		{
+			using unit_order = encoding::unit_order<encoding_type>;
+
+			// Only the first unit that differs determines the order
+			const size_type common_size = (std::min)(size(), other.size());
+			const size_type index = utility::mismatch_items<unit_type>{}(data(), other.data(), common_size);
+			if (index != common_size)
+			{
+				return unit_order::key(data()[index]) < unit_order::key(other.data()[index]) ? -1 : 1;
+			}
+
+			if (size() != other.size())
+			{
+				return size() < other.size() ? -1 : 1;
+			}
+
+			return 0;
+		}
+
+		// Compares the decoded points
+		LINGO_CONSTEXPR14 int compare_ordered(basic_string_view other, std::false_type) const noexcept(point_iterator::is_nothrow)
+		{
+			return compare_points(point_iterator(*this), point_iterator(other));
+		}
+
+		template <typename PointIterator>
+		static LINGO_CONSTEXPR14 int compare_points(PointIterator left, PointIterator right) noexcept(PointIterator::is_nothrow)
+		{
+			const PointIterator end;
+
+			for (; left != end && right != end; ++left, ++right)
+			{
+				const auto left_point = *left;
+				const auto right_point = *right;
+
+				if (left_point != right_point)
+				{
+					if (left_point < right_point)
+					{
+						return -1;
+					}
+					else
+					{
+						return 1;
+					}
+				}
+			}
+
+			if ((left == end) != (right == end))
+			{
+				if (left == end)
+				{
+					return -1;
+				}
+				else
+				{
+					return 1;
+				}
+			}
+			else
+			{
+				return 0;
+			}
+		}
+
 		private:
-		template <typename TextIterator, typename PatternIterator>
-		LINGO_CONSTEXPR14 TextIterator naive_find(TextIterator text_begin, TextIterator text_end, PatternIterator pattern_begin, PatternIterator pattern_end) const noexcept
+		using unit_key_type = typename std::make_unsigned<unit_type>::type;
+
+		// Converted needles up to this size are stored on the stack
+		static LINGO_CONSTEXPR11 const size_type inline_converted_size = 64;
+
+		template <typename OtherEncoding, typename OtherPage, typename Search>
+		size_type search_converted(basic_string_view<OtherEncoding, OtherPage> str, Search search) const
+		{
+			using converter_type = string_converter<OtherEncoding, OtherPage, encoding_type, page_type, error::stop>;
+
+			// Every unit of the source is at most a single point
+			const size_type buffer_size = str.size() * encoding_type::max_units;
+
+			unit_type inline_buffer[inline_converted_size];
+			std::unique_ptr<unit_type[]> heap_buffer;
+			unit_type* buffer = inline_buffer;
+			if (buffer_size > inline_converted_size)
+			{
+				heap_buffer.reset(new unit_type[buffer_size]);
+				buffer = heap_buffer.get();
+			}
+
+			const conversion_result result = converter_type().convert(
+				utility::span<const typename OtherEncoding::unit_type>(str.data(), str.size()),
+				utility::span<unit_type>(buffer, buffer_size),
+				true);
+			if (result.source_read != str.size())
+			{
+				return npos;
+			}
+
+			return search(basic_string_view(buffer, result.destination_written, false));
+		}
+
+		// Decodes the point at offset, moves offset to the next point and maps the point to ComparisonPage
+		template <typename ComparisonPage, typename StringEncoding, typename StringPage>
+		static typename ComparisonPage::point_type decode_comparison_point(basic_string_view<StringEncoding, StringPage> str, size_type& offset)
+		{
+			typename StringEncoding::point_type point{};
+			typename StringEncoding::decode_state_type state{};
+			const auto decode_result = StringEncoding::decode_one(
+				typename StringEncoding::decode_source_type(str.data() + offset, str.size() - offset),
+				typename StringEncoding::decode_destination_type(&point, 1),
+				state, true);
+			if (decode_result.error != error::error_code::success)
+			{
+				throw error::exception(decode_result.error);
+			}
+
+			offset = str.size() - decode_result.source.size();
+
+			const auto map_result = page::point_mapper<StringPage, ComparisonPage>::map(point);
+			if (map_result.error != error::error_code::success)
+			{
+				throw error::exception(map_result.error);
+			}
+
+			return map_result.point;
+		}
+
+		static point_set<point_type> make_point_set(basic_string_view str)
+		{
+			return point_set<point_type>(search_point_iterator(str), search_point_iterator());
+		}
+
+		// Decodes the point at pos, and returns the amount of units it takes up, or 0 if it is invalid
+		size_type decode_point_size(size_type pos) const noexcept
+		{
+			point_type point{};
+			typename encoding_type::decode_state_type state{};
+			const auto result = encoding_type::decode_one(
+				typename encoding_type::decode_source_type(data() + pos, size() - pos),
+				typename encoding_type::decode_destination_type(&point, 1),
+				state, true);
+
+			return result.error == error::error_code::success ? size() - pos - result.source.size() : 0;
+		}
+
+		size_type find_first_point(const point_set<point_type>& points, size_type pos, bool in_set) const noexcept
+		{
+			if (pos >= size())
+			{
+				return npos;
+			}
+
+			// ASCII sets can be found without decoding the ASCII units
+			LINGO_IF_CONSTEXPR(encoding::has_ascii_units<encoding_type>::value)
+			{
+				if (points.is_ascii())
+				{
+					const unit_type* const units = data();
+					while (pos < size())
+					{
+						const unit_key_type key = static_cast<unit_key_type>(units[pos]);
+						if (key < 0x80)
+						{
+							if (points.contains(static_cast<point_type>(key)) == in_set)
+							{
+								return pos;
+							}
+							++pos;
+						}
+						else
+						{
+							// A point above ASCII is never in the set, but it is decoded so that the search stops at an invalid point
+							const size_type point_size = decode_point_size(pos);
+							if (point_size == 0)
+							{
+								return npos;
+							}
+							if (!in_set)
+							{
+								return pos;
+							}
+							pos += point_size;
+						}
+					}
+
+					return npos;
+				}
+			}
+
+			const basic_string_view rest(data() + pos, size() - pos);
+			for (search_point_iterator it(rest), last; it != last; ++it)
+			{
+				if (points.contains(*it) == in_set)
+				{
+					return static_cast<size_type>(it.read_ptr() - data());
+				}
+			}
+
+			return npos;
+		}
+
+		size_type find_last_point(const point_set<point_type>& points, size_type pos, bool in_set) const noexcept
 		{
-			const TextIterator text_find_end = text_end - ((pattern_end - pattern_begin) - 1);
-			for (TextIterator text_find_it = text_begin; text_find_it != text_find_end; ++text_find_it)
+			// The search starts at the end of the point at pos
+			size_type end = size();
+			if (pos < size())
 			{
-				TextIterator text_it = text_find_it;
-				PatternIterator pattern_it = pattern_begin;
-				for (; pattern_it != pattern_end; ++text_it, ++pattern_it)
+				const size_type point_size = decode_point_size(pos);
+				if (point_size == 0)
 				{
-					if (*text_it != *pattern_it)
+					return npos;
+				}
+
+				end = pos + point_size;
+			}
+
+			return find_last_point(points, end, in_set, encoding::has_decode_back<encoding_type>());
+		}
+
+		size_type find_last_point(const point_set<point_type>& points, size_type end, bool in_set, std::true_type) const noexcept
+		{
+			// ASCII sets can be found without decoding the ASCII units, points above ASCII are still decoded so that the search stops at an invalid point
+			const bool ascii_set = encoding::has_ascii_units<encoding_type>::value && points.is_ascii();
+			const unit_type* const units = data();
+
+			while (end > 0)
+			{
+				if (ascii_set)
+				{
+					const unit_key_type key = static_cast<unit_key_type>(units[end - 1]);
+					if (key < 0x80)
 					{
-						break;
+						--end;
+						if (points.contains(static_cast<point_type>(key)) == in_set)
+						{
+							return end;
+						}
+						continue;
 					}
 				}
 
-				if (pattern_it == pattern_end)
+				point_type point{};
+				const auto result = encoding_type::decode_one_back(
+					typename encoding_type::decode_source_type(data(), end),
+					typename encoding_type::decode_destination_type(&point, 1));
+				if (result.error != error::error_code::success)
+				{
+					return npos;
+				}
+
+				end = result.source.size();
+				if (points.contains(point) == in_set)
 				{
-					return text_find_it;
+					return end;
 				}
 			}
 
-			return text_end;
+			return npos;
+		}
+
+		// Encodings that can not decode backwards are searched from the start, remembering the last match
+		size_type find_last_point(const point_set<point_type>& points, size_type end, bool in_set, std::false_type) const noexcept
+		{
+			size_type found = npos;
+			for (search_point_iterator it(*this), last; it != last && it.read_ptr() < data() + end; ++it)
+			{
+				if (points.contains(*it) == in_set)
+				{
+					found = static_cast<size_type>(it.read_ptr() - data());
+				}
+			}
+
+			return found;
+		}
+
+		// Encodings that can decode backwards can find the start of a point from any position
+		// A match of a pattern that starts with a complete point can only start at the beginning of a point in those encodings
+		LINGO_CONSTEXPR14 bool is_point_boundary(size_type, std::true_type) const noexcept
+		{
+			return true;
+		}
+
+		// Other encodings have to be decoded from the start to find the points
+		LINGO_CONSTEXPR14 bool is_point_boundary(size_type index, std::false_type) const noexcept
+		{
+			const unit_type* const target = data() + index;
+			for (search_point_iterator it(*this), last; it != last; ++it)
+			{
+				if (it.read_ptr() >= target)
+				{
+					return it.read_ptr() == target;
+				}
+			}
+
+			return index == size();
 		}
 
 		storage_type _storage;
@@ -652,17 +1052,42 @@ namespace lingo
 	LINGO_CONSTEXPR11 typename basic_string_view<Encoding, Page>::size_type basic_string_view<Encoding, Page>::npos;
 	template <typename Encoding, typename Page>
 	LINGO_CONSTEXPR11 bool basic_string_view<Encoding, Page>::is_execution_set;
+	template <typename Encoding, typename Page>
+	LINGO_CONSTEXPR11 typename basic_string_view<Encoding, Page>::size_type basic_string_view<Encoding, Page>::inline_converted_size;
 
 	template <typename Encoding, typename Page>
 	LINGO_CONSTEXPR14 bool operator == (basic_string_view<Encoding, Page> left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
 	{
+		// Strings with a unit order can only be equal if they have the same amount of units
+		LINGO_IF_CONSTEXPR(encoding::has_unit_order<Encoding>::value)
+		{
+			if (left.size() != right.size())
+			{
+				return false;
+			}
+		}
+
 		return left.compare(right) == 0;
 	}
 
 	template <typename Encoding, typename Page>
 	LINGO_CONSTEXPR14 bool operator != (basic_string_view<Encoding, Page> left, basic_string_view<Encoding, Page> right) noexcept(noexcept(left.compare(right)))
 	{
-		return left.compare(right) != 0;
+		return !(left == right);
+	}
+
+	template <typename LeftEncoding, typename LeftPage, typename RightEncoding, typename RightPage, typename std::enable_if<
+		!std::is_same<LeftEncoding, RightEncoding>::value || !std::is_same<LeftPage, RightPage>::value, int>::type = 0>
+	bool operator == (basic_string_view<LeftEncoding, LeftPage> left, basic_string_view<RightEncoding, RightPage> right)
+	{
+		return left.compare(right) == 0;
+	}
+
+	template <typename LeftEncoding, typename LeftPage, typename RightEncoding, typename RightPage, typename std::enable_if<
+		!std::is_same<LeftEncoding, RightEncoding>::value || !std::is_same<LeftPage, RightPage>::value, int>::type = 0>
+	bool operator != (basic_string_view<LeftEncoding, LeftPage> left, basic_string_view<RightEncoding, RightPage> right)
+	{
+		return !(left == right);
 	}
 
 	template <typename Encoding, typename Page>
@@ -15,12 +15,25 @@ namespace lingo
 			template <typename T>
 			struct compressed_pair_first<T, false>
 			{
+				compressed_pair_first() = default;
+
+				explicit compressed_pair_first(const T& first):
+					_first(first)
+				{
+				}
+
 				T _first;
 			};
 
 			template <typename T>
 			struct compressed_pair_first<T, true>
 			{
+				compressed_pair_first() = default;
+
+				explicit compressed_pair_first(const T&) noexcept
+				{
+				}
+
 				static T _first;
 			};
 
@@ -33,12 +46,25 @@ namespace lingo
 			template <typename T>
 			struct compressed_pair_second<T, false>
 			{
+				compressed_pair_second() = default;
+
+				explicit compressed_pair_second(const T& second):
+					_second(second)
+				{
+				}
+
 				T _second;
 			};
 
 			template <typename T>
 			struct compressed_pair_second<T, true>
 			{
+				compressed_pair_second() = default;
+
+				explicit compressed_pair_second(const T&) noexcept
+				{
+				}
+
 				static T _second;
 			};
 
@@ -55,10 +81,11 @@ namespace lingo
 
 			compressed_pair() = default;
 
-			compressed_pair(first_type first, second_type second)
+			// The members are copy constructed, so types that cannot be assigned (such as polymorphic allocators) can be stored as well
+			compressed_pair(const first_type& first, const second_type& second):
+				internal::compressed_pair_first<FirstT>(first),
+				internal::compressed_pair_second<SecondT>(second)
 			{
-				this->_first = first;
-				this->_second = second;
 			}
 
 			first_type& first() noexcept
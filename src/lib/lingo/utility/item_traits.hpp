@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <cstring>
 #include <type_traits>
+#include <utility>
 
 namespace lingo
 {
@@ -92,6 +93,49 @@ namespace lingo
 				}
 			};
 
+			// Destructive move between overlapping ranges
+			template <typename Item, typename = void>
+			struct destructive_move_overlapping_items_impl;
+
+			template <typename Item>
+			struct destructive_move_overlapping_items_impl<Item, typename std::enable_if<
+				std::is_trivially_move_constructible<Item>::value &&
+				std::is_trivially_destructible<Item>::value>::type>
+			{
+				void operator () (Item* destination, Item* source, size_t size) noexcept
+				{
+					std::memmove(destination, source, size * sizeof(Item));
+				}
+			};
+
+			template <typename Item>
+			struct destructive_move_overlapping_items_impl<Item, typename std::enable_if<
+				!(std::is_trivially_move_constructible<Item>::value &&
+				std::is_trivially_destructible<Item>::value) &&
+				std::is_move_constructible<Item>::value>::type>
+			{
+				// Every source item is destructed right after it is moved, so the destination item it overlaps with is never alive
+				void operator () (Item* destination, Item* source, size_t size) noexcept(noexcept(new (destination) Item(std::move(*source))))
+				{
+					if (destination < source)
+					{
+						for (size_t i = 0; i < size; ++i)
+						{
+							new (destination + i) Item(std::move(source[i]));
+							(source + i)->~Item();
+						}
+					}
+					else if (destination > source)
+					{
+						for (size_t i = size; i > 0; --i)
+						{
+							new (destination + i - 1) Item(std::move(source[i - 1]));
+							(source + i - 1)->~Item();
+						}
+					}
+				}
+			};
+
 			// destruct
 			template <typename Item, typename = void>
 			struct destruct_items_impl;
@@ -116,6 +160,56 @@ namespace lingo
 					}
 				}
 			};
+
+			// Mismatch
+			template <typename Item, typename = void>
+			struct mismatch_items_impl;
+
+			template <typename Item>
+			struct mismatch_items_impl<Item, typename std::enable_if<
+				std::is_integral<Item>::value || std::is_enum<Item>::value>::type>
+			{
+				size_t operator () (const Item* left, const Item* right, size_t size) noexcept
+				{
+					// Skip over equal blocks with memcmp, and only look at individual items in the block that differs
+					const size_t block_size = 64 / sizeof(Item) > 0 ? 64 / sizeof(Item) : 1;
+
+					size_t offset = 0;
+					while (size - offset >= block_size && std::memcmp(left + offset, right + offset, block_size * sizeof(Item)) == 0)
+					{
+						offset += block_size;
+					}
+
+					for (; offset < size; ++offset)
+					{
+						if (left[offset] != right[offset])
+						{
+							break;
+						}
+					}
+
+					return offset;
+				}
+			};
+
+			template <typename Item>
+			struct mismatch_items_impl<Item, typename std::enable_if<
+				!std::is_integral<Item>::value && !std::is_enum<Item>::value>::type>
+			{
+				size_t operator () (const Item* left, const Item* right, size_t size) noexcept(noexcept(*left != *right))
+				{
+					size_t offset = 0;
+					for (; offset < size; ++offset)
+					{
+						if (left[offset] != right[offset])
+						{
+							break;
+						}
+					}
+
+					return offset;
+				}
+			};
         }
 
 		template <typename Item>
@@ -130,6 +224,10 @@ namespace lingo
 		template <typename Item>
 		struct move_items : internal::move_items_impl<Item> {};
 
+		// Returns the index of the first item that differs, or size if all items are equal
+		template <typename Item>
+		struct mismatch_items : internal::mismatch_items_impl<Item> {};
+
 		template <typename Item>
 		struct destructive_move_items
 		{
@@ -141,6 +239,10 @@ namespace lingo
 				destruct_items<Item>{}(source, size);
 			}
 		};
+
+		// Like destructive_move_items, but the source and destination are allowed to overlap
+		template <typename Item>
+		struct destructive_move_overlapping_items : internal::destructive_move_overlapping_items_impl<Item> {};
     }
 }
 
@@ -0,0 +1,324 @@
+#ifndef H_LINGO_UTILITY_SEARCH
+#define H_LINGO_UTILITY_SEARCH
+
+#include <lingo/platform/constexpr.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace lingo
+{
+	namespace utility
+	{
+		// Returned by the search functions when there is no match
+		LINGO_CONSTEXPR11 const size_t not_found = SIZE_MAX;
+
+		namespace internal
+		{
+			// Views over a range of items, so the same search algorithms can run front to back and back to front
+			template <typename Item>
+			struct forward_items
+			{
+				const Item* items;
+
+				Item operator [] (size_t index) const noexcept
+				{
+					return items[index];
+				}
+			};
+
+			template <typename Item>
+			struct reverse_items
+			{
+				const Item* items_end;
+
+				Item operator [] (size_t index) const noexcept
+				{
+					return *(items_end - 1 - index);
+				}
+			};
+
+			// Returns the index of the first item in [offset, size) that is equal to value, or size if there is none
+			template <typename Items, typename Item>
+			size_t find_item(Items items, size_t offset, size_t size, Item value) noexcept
+			{
+				for (; offset < size; ++offset)
+				{
+					if (items[offset] == value)
+					{
+						break;
+					}
+				}
+
+				return offset;
+			}
+
+			template <typename Item, typename std::enable_if<sizeof(Item) == 1 && std::is_integral<Item>::value, int>::type = 0>
+			size_t find_item(forward_items<Item> items, size_t offset, size_t size, Item value) noexcept
+			{
+				const void* result = std::memchr(items.items + offset, static_cast<unsigned char>(value), size - offset);
+				return result != nullptr ? static_cast<size_t>(static_cast<const Item*>(result) - items.items) : size;
+			}
+
+			// Looks for the first and last item of the needle, and only compares the rest when both match
+			// Fast for short needles, but O(n*m) in the worst case
+			template <typename Items>
+			size_t filter_search(Items haystack, size_t haystack_size, Items needle, size_t needle_size) noexcept
+			{
+				const auto first = needle[0];
+				const auto last = needle[needle_size - 1];
+				const size_t end = haystack_size - needle_size + 1;
+
+				for (size_t i = 0; i < end; ++i)
+				{
+					i = find_item(haystack, i, end, first);
+					if (i == end)
+					{
+						break;
+					}
+
+					if (haystack[i + needle_size - 1] == last)
+					{
+						size_t j = 1;
+						while (j + 1 < needle_size && haystack[i + j] == needle[j])
+						{
+							++j;
+						}
+
+						if (j + 1 >= needle_size)
+						{
+							return i;
+						}
+					}
+				}
+
+				return not_found;
+			}
+
+			// Computes the critical factorization of the needle, as described by Crochemore and Perrin
+			// Returns the start of the right half, and stores the period of the right half in period
+			template <typename Items>
+			size_t critical_factorization(Items needle, size_t needle_size, size_t& period) noexcept
+			{
+				// Maximal suffix for the normal order
+				size_t max_suffix = SIZE_MAX;
+				size_t j = 0;
+				size_t k = 1;
+				period = 1;
+				while (j + k < needle_size)
+				{
+					const auto a = needle[j + k];
+					const auto b = needle[max_suffix + k];
+					if (a < b)
+					{
+						j += k;
+						k = 1;
+						period = j - max_suffix;
+					}
+					else if (a == b)
+					{
+						if (k != period)
+						{
+							++k;
+						}
+						else
+						{
+							j += period;
+							k = 1;
+						}
+					}
+					else
+					{
+						max_suffix = j++;
+						k = period = 1;
+					}
+				}
+
+				// Maximal suffix for the reversed order
+				size_t max_suffix_reverse = SIZE_MAX;
+				size_t period_reverse = 1;
+				j = 0;
+				k = 1;
+				while (j + k < needle_size)
+				{
+					const auto a = needle[j + k];
+					const auto b = needle[max_suffix_reverse + k];
+					if (b < a)
+					{
+						j += k;
+						k = 1;
+						period_reverse = j - max_suffix_reverse;
+					}
+					else if (a == b)
+					{
+						if (k != period_reverse)
+						{
+							++k;
+						}
+						else
+						{
+							j += period_reverse;
+							k = 1;
+						}
+					}
+					else
+					{
+						max_suffix_reverse = j++;
+						k = period_reverse = 1;
+					}
+				}
+
+				// Use the longer suffix
+				if (max_suffix_reverse + 1 < max_suffix + 1)
+				{
+					return max_suffix + 1;
+				}
+
+				period = period_reverse;
+				return max_suffix_reverse + 1;
+			}
+
+			// Two-Way string matching, O(n + m) time and O(1) space
+			template <typename Items>
+			size_t two_way_search(Items haystack, size_t haystack_size, Items needle, size_t needle_size) noexcept
+			{
+				size_t period = 0;
+				const size_t suffix = critical_factorization(needle, needle_size, period);
+
+				// Check if the left half is a repetition of the period
+				size_t periodic_size = 0;
+				while (periodic_size < suffix && needle[periodic_size] == needle[periodic_size + period])
+				{
+					++periodic_size;
+				}
+
+				const size_t last_position = haystack_size - needle_size;
+				if (periodic_size == suffix)
+				{
+					// The needle is periodic, remember how much of the needle is known to match after a shift by the period
+					size_t memory = 0;
+					size_t j = 0;
+					while (j <= last_position)
+					{
+						// Match the right half
+						size_t i = suffix > memory ? suffix : memory;
+						while (i < needle_size && needle[i] == haystack[i + j])
+						{
+							++i;
+						}
+
+						if (i >= needle_size)
+						{
+							// Match the left half
+							i = suffix - 1;
+							while (memory < i + 1 && needle[i] == haystack[i + j])
+							{
+								--i;
+							}
+
+							if (i + 1 < memory + 1)
+							{
+								return j;
+							}
+
+							j += period;
+							memory = needle_size - period;
+						}
+						else
+						{
+							j += i - suffix + 1;
+							memory = 0;
+						}
+					}
+				}
+				else
+				{
+					// The halves are distinct, so any mismatch in the left half allows a shift past the longest half
+					period = (suffix > needle_size - suffix ? suffix : needle_size - suffix) + 1;
+					size_t j = 0;
+					while (j <= last_position)
+					{
+						// Match the right half
+						size_t i = suffix;
+						while (i < needle_size && needle[i] == haystack[i + j])
+						{
+							++i;
+						}
+
+						if (i >= needle_size)
+						{
+							// Match the left half
+							i = suffix - 1;
+							while (i != SIZE_MAX && needle[i] == haystack[i + j])
+							{
+								--i;
+							}
+
+							if (i == SIZE_MAX)
+							{
+								return j;
+							}
+
+							j += period;
+						}
+						else
+						{
+							j += i - suffix + 1;
+						}
+					}
+				}
+
+				return not_found;
+			}
+
+			template <typename Items>
+			size_t search(Items haystack, size_t haystack_size, Items needle, size_t needle_size) noexcept
+			{
+				// Needles up to this size use the filter, longer needles use Two-Way to keep the worst case linear
+				const size_t filter_needle_size = 16;
+
+				if (needle_size == 0)
+				{
+					return 0;
+				}
+				else if (needle_size > haystack_size)
+				{
+					return not_found;
+				}
+				else if (needle_size <= filter_needle_size)
+				{
+					return filter_search(haystack, haystack_size, needle, needle_size);
+				}
+				else
+				{
+					return two_way_search(haystack, haystack_size, needle, needle_size);
+				}
+			}
+		}
+
+		// Returns the index of the first occurrence of needle in haystack, or not_found if there is none
+		template <typename Item>
+		size_t search_items(const Item* haystack, size_t haystack_size, const Item* needle, size_t needle_size) noexcept
+		{
+			return internal::search(
+				internal::forward_items<Item>{ haystack }, haystack_size,
+				internal::forward_items<Item>{ needle }, needle_size);
+		}
+
+		// Returns the index of the last occurrence of needle in haystack, or not_found if there is none
+		template <typename Item>
+		size_t search_items_reverse(const Item* haystack, size_t haystack_size, const Item* needle, size_t needle_size) noexcept
+		{
+			// The search runs over the reversed haystack and needle, so the result is the offset of the end of the match from the back
+			const size_t result = internal::search(
+				internal::reverse_items<Item>{ haystack + haystack_size }, haystack_size,
+				internal::reverse_items<Item>{ needle + needle_size }, needle_size);
+
+			return result != not_found ? haystack_size - result - needle_size : not_found;
+		}
+	}
+}
+
+#endif
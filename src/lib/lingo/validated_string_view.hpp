@@ -0,0 +1,158 @@
+#ifndef H_LINGO_VALIDATED_STRING_VIEW
+#define H_LINGO_VALIDATED_STRING_VIEW
+
+#include <lingo/platform/constexpr.hpp>
+
+#include <lingo/string_view.hpp>
+
+#include <lingo/encoding/point_iterator.hpp>
+#include <lingo/encoding/unit_order.hpp>
+
+#include <lingo/error/assume_valid.hpp>
+#include <lingo/error/error_code.hpp>
+#include <lingo/error/exception.hpp>
+
+#include <lingo/utility/span.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace lingo
+{
+	struct assume_valid_t
+	{
+		explicit LINGO_CONSTEXPR11 assume_valid_t() noexcept = default;
+	};
+
+	LINGO_CONSTEXPR11 assume_valid_t assume_valid{};
+
+	// A string view that is known to only contain valid code points
+	// Point iteration, comparisons and conversions on validated views skip all validation
+	template <typename Encoding, typename Page>
+	class basic_validated_string_view : public basic_string_view<Encoding, Page>
+	{
+		public:
+		using basic_string_view_type = basic_string_view<Encoding, Page>;
+
+		using encoding_type = typename basic_string_view_type::encoding_type;
+		using page_type = typename basic_string_view_type::page_type;
+
+		using unit_type = typename basic_string_view_type::unit_type;
+		using point_type = typename basic_string_view_type::point_type;
+
+		using size_type = typename basic_string_view_type::size_type;
+		using difference_type = typename basic_string_view_type::difference_type;
+
+		using point_iterator = encoding::point_iterator<encoding_type, error::assume_valid<encoding_type, page_type>>;
+
+		LINGO_CONSTEXPR11 basic_validated_string_view() noexcept = default;
+		LINGO_CONSTEXPR11 basic_validated_string_view(const basic_validated_string_view&) noexcept = default;
+		LINGO_CONSTEXPR11 basic_validated_string_view(basic_validated_string_view&&) noexcept = default;
+
+		// Validates the string, throws error::exception if it contains invalid units
+		explicit LINGO_CONSTEXPR14 basic_validated_string_view(basic_string_view_type str):
+			basic_string_view_type(str)
+		{
+			const error::error_code result = validate(str);
+			if (result != error::error_code::success)
+			{
+				throw error::exception(result);
+			}
+		}
+
+		// Does not validate the string, the caller guarantees that it is valid
+		LINGO_CONSTEXPR11 basic_validated_string_view(basic_string_view_type str, assume_valid_t) noexcept:
+			basic_string_view_type(str)
+		{
+		}
+
+		static LINGO_CONSTEXPR14 error::error_code validate(basic_string_view_type str) noexcept
+		{
+			utility::span<const unit_type> source(str.data(), str.size());
+			typename encoding_type::decode_state_type state{};
+
+			while (source.size() > 0)
+			{
+				point_type point{};
+				const auto result = encoding_type::decode_one(source, utility::span<point_type>(&point, 1), state, true);
+				if (result.error != error::error_code::success)
+				{
+					return result.error;
+				}
+
+				source = result.source;
+			}
+
+			return error::error_code::success;
+		}
+
+		LINGO_CONSTEXPR14 point_iterator point_begin() const noexcept
+		{
+			return point_iterator(*this);
+		}
+
+		LINGO_CONSTEXPR14 point_iterator point_end() const noexcept
+		{
+			return point_iterator();
+		}
+
+		using basic_string_view_type::compare;
+
+		LINGO_CONSTEXPR14 int compare(basic_validated_string_view other) const noexcept
+		{
+			return compare(other, encoding::has_unit_order<encoding_type>());
+		}
+
+		LINGO_CONSTEXPR14 basic_validated_string_view& operator = (const basic_validated_string_view&) noexcept = default;
+		LINGO_CONSTEXPR14 basic_validated_string_view& operator = (basic_validated_string_view&&) noexcept = default;
+
+		private:
+		LINGO_CONSTEXPR14 int compare(basic_validated_string_view other, std::true_type) const noexcept
+		{
+			return basic_string_view_type::compare_ordered(other, std::true_type());
+		}
+
+		LINGO_CONSTEXPR14 int compare(basic_validated_string_view other, std::false_type) const noexcept
+		{
+			return basic_string_view_type::compare_points(point_iterator(*this), point_iterator(other));
+		}
+	};
+
+	template <typename Encoding, typename Page>
+	LINGO_CONSTEXPR14 bool operator == (basic_validated_string_view<Encoding, Page> left, basic_validated_string_view<Encoding, Page> right) noexcept
+	{
+		return left.compare(right) == 0;
+	}
+
+	template <typename Encoding, typename Page>
+	LINGO_CONSTEXPR14 bool operator != (basic_validated_string_view<Encoding, Page> left, basic_validated_string_view<Encoding, Page> right) noexcept
+	{
+		return left.compare(right) != 0;
+	}
+
+	template <typename Encoding, typename Page>
+	LINGO_CONSTEXPR14 bool operator < (basic_validated_string_view<Encoding, Page> left, basic_validated_string_view<Encoding, Page> right) noexcept
+	{
+		return left.compare(right) < 0;
+	}
+
+	template <typename Encoding, typename Page>
+	LINGO_CONSTEXPR14 bool operator > (basic_validated_string_view<Encoding, Page> left, basic_validated_string_view<Encoding, Page> right) noexcept
+	{
+		return left.compare(right) > 0;
+	}
+
+	template <typename Encoding, typename Page>
+	LINGO_CONSTEXPR14 bool operator <= (basic_validated_string_view<Encoding, Page> left, basic_validated_string_view<Encoding, Page> right) noexcept
+	{
+		return left.compare(right) <= 0;
+	}
+
+	template <typename Encoding, typename Page>
+	LINGO_CONSTEXPR14 bool operator >= (basic_validated_string_view<Encoding, Page> left, basic_validated_string_view<Encoding, Page> right) noexcept
+	{
+		return left.compare(right) >= 0;
+	}
+}
+
+#endif
@@ -0,0 +1,146 @@
+#include <catch/catch.hpp>
+
+#if LINGO_TEST_SPLIT
+#include <lingo/encoding/decode_back.hpp>
+#include <lingo/encoding/none.hpp>
+#include <lingo/encoding/utf8.hpp>
+#include <lingo/encoding/utf16.hpp>
+#include <lingo/encoding/utf32.hpp>
+
+#include <lingo/encoding/base.hpp>
+#else
+#include <lingo/test/include_all.hpp>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+	using utf8_encoding = lingo::encoding::utf8<char, char32_t>;
+	using utf16_encoding = lingo::encoding::utf16<char16_t, char32_t>;
+
+	template <typename Encoding>
+	std::vector<typename Encoding::unit_type> encode_all(const std::vector<typename Encoding::point_type>& points)
+	{
+		std::vector<typename Encoding::unit_type> units(points.size() * Encoding::max_units);
+		lingo::utility::span<const typename Encoding::point_type> source(points.data(), points.size());
+		lingo::utility::span<typename Encoding::unit_type> destination(units.data(), units.size());
+		typename Encoding::encode_state_type state{};
+
+		while (source.size() > 0)
+		{
+			const auto result = Encoding::encode_one(source, destination, state, true);
+			REQUIRE(result.error == lingo::error::error_code::success);
+			source = result.source;
+			destination = result.destination;
+		}
+
+		units.resize(units.size() - destination.size());
+		return units;
+	}
+
+	template <typename Encoding>
+	std::vector<typename Encoding::point_type> decode_all_back(const std::vector<typename Encoding::unit_type>& units)
+	{
+		std::vector<typename Encoding::point_type> points;
+		lingo::utility::span<const typename Encoding::unit_type> source(units.data(), units.size());
+
+		while (source.size() > 0)
+		{
+			typename Encoding::point_type point{};
+			const auto result = Encoding::decode_one_back(source, lingo::utility::span<typename Encoding::point_type>(&point, 1));
+			REQUIRE(result.error == lingo::error::error_code::success);
+			REQUIRE(result.source.data() == source.data());
+			REQUIRE(result.source.size() < source.size());
+			points.push_back(point);
+			source = result.source;
+		}
+
+		std::reverse(points.begin(), points.end());
+		return points;
+	}
+
+	template <typename Encoding>
+	lingo::error::error_code decode_back_error_function(const typename Encoding::unit_type* units, std::size_t size)
+	{
+		typename Encoding::point_type point{};
+		return Encoding::decode_one_back(
+			lingo::utility::span<const typename Encoding::unit_type>(units, size),
+			lingo::utility::span<typename Encoding::point_type>(&point, 1)).error;
+	}
+
+	using decode_back_test_types = std::tuple<
+		lingo::encoding::utf8<char, char32_t>,
+		lingo::encoding::utf8_se<char16_t, char32_t>,
+		lingo::encoding::utf16<char16_t, char32_t>,
+		lingo::encoding::utf16_se<char16_t, char32_t>,
+		lingo::encoding::utf32<char32_t, char32_t>,
+		lingo::encoding::utf32_se<char32_t, char32_t>,
+		lingo::encoding::none<char, char>>;
+}
+
+TEMPLATE_LIST_TEST_CASE("decode_one_back decodes the same points as decode_one", "", decode_back_test_types)
+{
+	using encoding_type = TestType;
+	using point_type = typename encoding_type::point_type;
+
+	REQUIRE(lingo::encoding::has_decode_back<encoding_type>::value);
+
+	std::vector<point_type> points;
+	for (std::size_t point : { 0x24, 0x7F, 0x41, 0xA2, 0xE9, 0x7A, 0x20AC, 0xD55C, 0x10348, 0x1F600, 0x7F })
+	{
+		// Skip points that do not fit in the point type
+		if (point <= static_cast<std::size_t>(std::numeric_limits<point_type>::max()))
+		{
+			points.push_back(static_cast<point_type>(point));
+		}
+	}
+
+	REQUIRE(decode_all_back<encoding_type>(encode_all<encoding_type>(points)) == points);
+}
+
+TEST_CASE("decode_one_back detects invalid units")
+{
+	SECTION("utf8")
+	{
+		const auto decode_back_error = decode_back_error_function<utf8_encoding>;
+
+		// Stray continuation unit after a complete point
+		REQUIRE(decode_back_error("a\x80", 2) == lingo::error::error_code::invalid_unit);
+
+		// Truncated point at the end
+		REQUIRE(decode_back_error("a\xE2\x82", 3) == lingo::error::error_code::invalid_unit);
+
+		// Too many continuation units
+		REQUIRE(decode_back_error("\xF0\x80\x80\x80\x80", 5) == lingo::error::error_code::invalid_unit);
+
+		// Only continuation units, the first unit might be before the buffer
+		REQUIRE(decode_back_error("\x82\xAC", 2) == lingo::error::error_code::source_buffer_too_small);
+
+		// Empty buffer
+		REQUIRE(decode_back_error("", 0) == lingo::error::error_code::source_buffer_too_small);
+	}
+
+	SECTION("utf16")
+	{
+		const auto decode_back_error = decode_back_error_function<utf16_encoding>;
+
+		// Lone high surrogate at the end
+		REQUIRE(decode_back_error(u"a\xD83D", 2) == lingo::error::error_code::invalid_unit);
+
+		// Low surrogate that does not follow a high surrogate
+		REQUIRE(decode_back_error(u"a\xDE00", 2) == lingo::error::error_code::invalid_unit);
+
+		// Low surrogate at the start of the buffer
+		REQUIRE(decode_back_error(u"\xDE00", 1) == lingo::error::error_code::source_buffer_too_small);
+	}
+}
+
+TEST_CASE("Encodings that can not find the start of a point do not decode backwards")
+{
+	REQUIRE_FALSE(lingo::encoding::has_decode_back<lingo::encoding::base64<char, char>>::value);
+}
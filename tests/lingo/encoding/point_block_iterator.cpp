@@ -0,0 +1,149 @@
+#include <catch/catch.hpp>
+
+#if LINGO_TEST_SPLIT
+#include <lingo/string_view.hpp>
+
+#include <lingo/encoding/point_block_iterator.hpp>
+#include <lingo/encoding/point_iterator.hpp>
+#include <lingo/encoding/utf8.hpp>
+
+#include <lingo/error/exception.hpp>
+#include <lingo/error/handler_tag.hpp>
+#include <lingo/error/replace.hpp>
+#include <lingo/error/stop.hpp>
+#include <lingo/error/strict.hpp>
+
+#include <lingo/page/unicode.hpp>
+#else
+#include <lingo/test/include_all.hpp>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+	using utf8_encoding = lingo::encoding::utf8<char, char32_t>;
+	using unicode_page = lingo::page::unicode_default;
+	using utf8_string_view = lingo::basic_string_view<utf8_encoding, unicode_page>;
+
+	template <template <typename, typename> class ErrorHandler, std::size_t BlockSize>
+	using test_point_block_iterator = lingo::encoding::point_block_iterator<utf8_encoding, ErrorHandler<utf8_encoding, unicode_page>, BlockSize>;
+
+	template <typename PointBlockIterator>
+	std::vector<std::vector<char32_t>> decode_blocks(utf8_string_view view)
+	{
+		std::vector<std::vector<char32_t>> blocks;
+		for (PointBlockIterator it(view), last; it != last; ++it)
+		{
+			const auto block = *it;
+			blocks.emplace_back(block.data(), block.data() + block.size());
+		}
+		return blocks;
+	}
+}
+
+TEST_CASE("point_block_iterator decodes points in blocks")
+{
+	// "aé\U0001F600bc"
+	const char units[] = "a\xC3\xA9\xF0\x9F\x98\x80" "bc";
+	const utf8_string_view view(units, sizeof(units) - 1);
+
+	SECTION("Block size smaller than the string")
+	{
+		const auto blocks = decode_blocks<test_point_block_iterator<lingo::error::strict, 2>>(view);
+		REQUIRE(blocks.size() == 3);
+		REQUIRE(blocks[0] == std::vector<char32_t>{ U'a', U'é' });
+		REQUIRE(blocks[1] == std::vector<char32_t>{ U'\U0001F600', U'b' });
+		REQUIRE(blocks[2] == std::vector<char32_t>{ U'c' });
+	}
+
+	SECTION("Block size larger than the string")
+	{
+		const auto blocks = decode_blocks<test_point_block_iterator<lingo::error::strict, 64>>(view);
+		REQUIRE(blocks.size() == 1);
+		REQUIRE(blocks[0] == std::vector<char32_t>{ U'a', U'é', U'\U0001F600', U'b', U'c' });
+	}
+
+	SECTION("read_ptr points to the start of the block")
+	{
+		test_point_block_iterator<lingo::error::strict, 2> it(view);
+		REQUIRE(it.read_ptr() == units);
+		++it;
+		REQUIRE(it.read_ptr() == units + 3);
+	}
+
+	SECTION("Postfix increment does not return a copy whose block would dangle")
+	{
+		test_point_block_iterator<lingo::error::strict, 2> it(view);
+		static_assert(std::is_void<decltype(it++)>::value, "postfix increment returns void");
+		it++;
+		REQUIRE(it.read_ptr() == units + 3);
+		REQUIRE((*it)[0] == U'\U0001F600');
+	}
+
+	SECTION("Empty string")
+	{
+		using iterator_type = test_point_block_iterator<lingo::error::strict, 4>;
+		REQUIRE(iterator_type(utf8_string_view(units, 0)) == iterator_type());
+	}
+}
+
+TEST_CASE("point_block_iterator produces the same points as point_iterator")
+{
+	std::string units;
+	for (int i = 0; i < 100; ++i)
+	{
+		units += "x\xE2\x82\xAC";
+	}
+	const utf8_string_view view(units.data(), units.size());
+
+	std::vector<char32_t> expected;
+	std::copy(lingo::encoding::point_iterator<utf8_encoding>(view), lingo::encoding::point_iterator<utf8_encoding>(), std::back_inserter(expected));
+
+	std::vector<char32_t> points;
+	std::size_t block_count = 0;
+	lingo::encoding::for_each_point_block(view, [&](lingo::utility::span<const char32_t> block)
+	{
+		points.insert(points.end(), block.data(), block.data() + block.size());
+		++block_count;
+	});
+
+	REQUIRE(points == expected);
+	REQUIRE(block_count == 4);
+}
+
+TEST_CASE("point_block_iterator handles errors with its error handler")
+{
+	const char invalid_units[] = "a\x80" "bc";
+	const utf8_string_view view(invalid_units, sizeof(invalid_units) - 1);
+
+	SECTION("strict")
+	{
+		REQUIRE_THROWS_AS((decode_blocks<test_point_block_iterator<lingo::error::strict, 2>>(view)), lingo::error::exception);
+	}
+
+	SECTION("replace")
+	{
+		const auto blocks = decode_blocks<test_point_block_iterator<lingo::error::replace, 2>>(view);
+		REQUIRE(blocks.size() == 2);
+		REQUIRE(blocks[0] == std::vector<char32_t>{ U'a', U'\uFFFD' });
+		REQUIRE(blocks[1] == std::vector<char32_t>{ U'b', U'c' });
+	}
+
+	SECTION("stop")
+	{
+		REQUIRE(test_point_block_iterator<lingo::error::stop, 2>::is_nothrow);
+
+		std::vector<char32_t> points;
+		lingo::encoding::for_each_point_block<2>(view, lingo::error::handler_tag<lingo::error::stop>(), [&](lingo::utility::span<const char32_t> block)
+		{
+			points.insert(points.end(), block.data(), block.data() + block.size());
+		});
+		REQUIRE(points == std::vector<char32_t>{ U'a' });
+	}
+}
@@ -0,0 +1,146 @@
+#include <catch/catch.hpp>
+
+#if LINGO_TEST_SPLIT
+#include <lingo/string_view.hpp>
+
+#include <lingo/encoding/point_iterator.hpp>
+#include <lingo/encoding/base.hpp>
+#include <lingo/encoding/utf8.hpp>
+#include <lingo/encoding/utf16.hpp>
+
+#include <lingo/error/exception.hpp>
+#include <lingo/error/replace.hpp>
+#include <lingo/error/skip.hpp>
+#include <lingo/error/stop.hpp>
+#include <lingo/error/strict.hpp>
+
+#include <lingo/page/unicode.hpp>
+#else
+#include <lingo/test/include_all.hpp>
+#endif
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+	using utf8_encoding = lingo::encoding::utf8<char, char32_t>;
+	using unicode_page = lingo::page::unicode_default;
+	using utf8_string_view = lingo::basic_string_view<utf8_encoding, unicode_page>;
+
+	template <template <typename, typename> class ErrorHandler>
+	using test_point_iterator = lingo::encoding::point_iterator<utf8_encoding, ErrorHandler<utf8_encoding, unicode_page>>;
+
+	template <typename PointIterator>
+	std::vector<char32_t> decode_all(utf8_string_view view)
+	{
+		std::vector<char32_t> points;
+		std::copy(PointIterator(view), PointIterator(), std::back_inserter(points));
+		return points;
+	}
+
+	const char invalid_units[] = "a\x80" "b\xE2\x82";
+	const utf8_string_view invalid_view(invalid_units, sizeof(invalid_units) - 1);
+}
+
+TEST_CASE("point_iterator is only noexcept with a non throwing error handler")
+{
+	REQUIRE_FALSE(test_point_iterator<lingo::error::strict>::is_nothrow);
+	REQUIRE(test_point_iterator<lingo::error::replace>::is_nothrow);
+	REQUIRE(test_point_iterator<lingo::error::skip>::is_nothrow);
+	REQUIRE(test_point_iterator<lingo::error::stop>::is_nothrow);
+
+	REQUIRE_FALSE(noexcept(++std::declval<test_point_iterator<lingo::error::strict>&>()));
+	REQUIRE(noexcept(++std::declval<test_point_iterator<lingo::error::stop>&>()));
+	REQUIRE(noexcept(test_point_iterator<lingo::error::replace>(invalid_view)));
+}
+
+TEST_CASE("point_iterator handles errors with its error handler")
+{
+	SECTION("strict")
+	{
+		REQUIRE_THROWS_AS(decode_all<test_point_iterator<lingo::error::strict>>(invalid_view), lingo::error::exception);
+	}
+
+	SECTION("replace")
+	{
+		REQUIRE(decode_all<test_point_iterator<lingo::error::replace>>(invalid_view) == std::vector<char32_t>{ U'a', U'\uFFFD', U'b', U'\uFFFD' });
+	}
+
+	SECTION("skip")
+	{
+		REQUIRE(decode_all<test_point_iterator<lingo::error::skip>>(invalid_view) == std::vector<char32_t>{ U'a', U'b' });
+	}
+
+	SECTION("stop")
+	{
+		REQUIRE(decode_all<test_point_iterator<lingo::error::stop>>(invalid_view) == std::vector<char32_t>{ U'a' });
+
+		// Stopping on the first point results in the end iterator
+		REQUIRE(test_point_iterator<lingo::error::stop>(utf8_string_view(invalid_units + 1, 1)) == test_point_iterator<lingo::error::stop>());
+	}
+}
+
+TEST_CASE("point_iterator is bidirectional if the encoding can decode backwards")
+{
+	REQUIRE(std::is_same<lingo::encoding::point_iterator<utf8_encoding>::iterator_category, std::bidirectional_iterator_tag>::value);
+	REQUIRE(std::is_same<lingo::encoding::point_iterator<lingo::encoding::utf16_se<char16_t, char32_t>>::iterator_category, std::bidirectional_iterator_tag>::value);
+	REQUIRE(std::is_same<lingo::encoding::point_iterator<lingo::encoding::base64<char, char>>::iterator_category, std::input_iterator_tag>::value);
+
+	// "aé\U0001F600b"
+	const char units[] = "a\xC3\xA9\xF0\x9F\x98\x80" "b";
+	const utf8_string_view view(units, sizeof(units) - 1);
+
+	using point_iterator = lingo::encoding::point_iterator<utf8_encoding>;
+	const point_iterator first(view);
+	point_iterator last(view);
+	while (last != point_iterator())
+	{
+		++last;
+	}
+
+	SECTION("Decrementing")
+	{
+		point_iterator it = last;
+		--it;
+		REQUIRE(*it == U'b');
+		REQUIRE(it.read_ptr() == units + 7);
+		--it;
+		REQUIRE(*it == U'\U0001F600');
+		REQUIRE(it.read_ptr() == units + 3);
+		REQUIRE(*it-- == U'\U0001F600');
+		REQUIRE(*it == U'é');
+		--it;
+		REQUIRE(*it == U'a');
+		REQUIRE(it == first);
+
+		// Moving forward again
+		++it;
+		REQUIRE(*it == U'é');
+	}
+
+	SECTION("Reverse iteration")
+	{
+		std::vector<char32_t> points;
+		std::copy(std::reverse_iterator<point_iterator>(last), std::reverse_iterator<point_iterator>(first), std::back_inserter(points));
+		REQUIRE(points == std::vector<char32_t>{ U'b', U'\U0001F600', U'é', U'a' });
+	}
+
+	SECTION("Error handling")
+	{
+		const utf8_string_view invalid(invalid_units, sizeof(invalid_units) - 1);
+
+		using replace_iterator = test_point_iterator<lingo::error::replace>;
+		replace_iterator replace_last(invalid);
+		while (replace_last != replace_iterator())
+		{
+			++replace_last;
+		}
+
+		std::vector<char32_t> points;
+		std::copy(std::reverse_iterator<replace_iterator>(replace_last), std::reverse_iterator<replace_iterator>(replace_iterator(invalid)), std::back_inserter(points));
+		REQUIRE(points == std::vector<char32_t>{ U'\uFFFD', U'\uFFFD', U'b', U'\uFFFD', U'a' });
+	}
+}
@@ -0,0 +1,76 @@
+#include <catch/catch.hpp>
+
+#if LINGO_TEST_SPLIT
+#include <lingo/encoding/join.hpp>
+#include <lingo/encoding/none.hpp>
+#include <lingo/encoding/unchecked.hpp>
+#include <lingo/encoding/utf8.hpp>
+#include <lingo/encoding/utf16.hpp>
+#include <lingo/encoding/utf32.hpp>
+#else
+#include <lingo/test/include_all.hpp>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+
+namespace
+{
+	// Encodes and decodes every valid point with both the checked and unchecked functions, and returns the first point for which they differ
+	template <typename Encoding>
+	char32_t find_unchecked_mismatch()
+	{
+		using unit_type = typename Encoding::unit_type;
+		using point_type = typename Encoding::point_type;
+		using unchecked = lingo::encoding::unchecked<Encoding>;
+
+		for (char32_t i = 0; i < 0x110000; ++i)
+		{
+			// Skip surrogates
+			if (i >= 0xD800 && i < 0xE000)
+			{
+				continue;
+			}
+
+			const point_type point = static_cast<point_type>(i);
+
+			unit_type checked_units[Encoding::max_units] = {};
+			unit_type unchecked_units[Encoding::max_units] = {};
+			typename Encoding::encode_state_type encode_state{};
+
+			const auto checked_encode = Encoding::encode_one(lingo::utility::span<const point_type>(&point, 1), lingo::utility::span<unit_type>(checked_units), encode_state, true);
+			const auto unchecked_encode = unchecked::encode_one(lingo::utility::span<const point_type>(&point, 1), lingo::utility::span<unit_type>(unchecked_units), encode_state, true);
+			if (checked_encode.error != lingo::error::error_code::success ||
+				checked_encode.destination.size() != unchecked_encode.destination.size() ||
+				!std::equal(checked_units, checked_units + Encoding::max_units, unchecked_units))
+			{
+				return i;
+			}
+
+			const std::size_t unit_count = Encoding::max_units - checked_encode.destination.size();
+			point_type decoded_point{};
+			typename Encoding::decode_state_type decode_state{};
+			const auto unchecked_decode = unchecked::decode_one(lingo::utility::span<const unit_type>(unchecked_units, unit_count), lingo::utility::span<point_type>(&decoded_point, 1), decode_state, true);
+			if (decoded_point != point || unchecked_decode.source.size() != 0 || unchecked_decode.destination.size() != 0)
+			{
+				return i;
+			}
+		}
+
+		return 0x110000;
+	}
+}
+
+TEST_CASE("unchecked encoding and decoding matches the checked functions")
+{
+	REQUIRE(lingo::encoding::has_unchecked_decode<lingo::encoding::utf8<char, char32_t>>::value);
+	REQUIRE(lingo::encoding::has_unchecked_encode<lingo::encoding::utf16<char16_t, char32_t>>::value);
+
+	REQUIRE(find_unchecked_mismatch<lingo::encoding::utf8<char, char32_t>>() == 0x110000);
+	REQUIRE(find_unchecked_mismatch<lingo::encoding::utf16<char16_t, char32_t>>() == 0x110000);
+	REQUIRE(find_unchecked_mismatch<lingo::encoding::utf32<char32_t, char32_t>>() == 0x110000);
+	REQUIRE(find_unchecked_mismatch<lingo::encoding::none<char32_t, char32_t>>() == 0x110000);
+
+	// Joined encodings
+	REQUIRE(find_unchecked_mismatch<lingo::encoding::utf16_se<char16_t, char32_t>>() == 0x110000);
+}
@@ -0,0 +1,150 @@
+#include <catch/catch.hpp>
+
+#if LINGO_TEST_SPLIT
+#include <lingo/string_view.hpp>
+
+#include <lingo/encoding/base.hpp>
+#include <lingo/encoding/none.hpp>
+#include <lingo/encoding/unit_order.hpp>
+#include <lingo/encoding/utf8.hpp>
+#include <lingo/encoding/utf16.hpp>
+#include <lingo/encoding/utf32.hpp>
+
+#include <lingo/page/unicode.hpp>
+#else
+#include <lingo/test/include_all.hpp>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+	template <typename Encoding>
+	std::vector<typename Encoding::unit_type> encode_points(const std::vector<char32_t>& points)
+	{
+		std::vector<typename Encoding::unit_type> units(points.size() * Encoding::max_units);
+		lingo::utility::span<typename Encoding::unit_type> destination(units.data(), units.size());
+
+		for (char32_t point : points)
+		{
+			const typename Encoding::point_type source_point = static_cast<typename Encoding::point_type>(point);
+			typename Encoding::encode_state_type state{};
+			const auto result = Encoding::encode_one(lingo::utility::span<const typename Encoding::point_type>(&source_point, 1), destination, state, true);
+			REQUIRE(result.error == lingo::error::error_code::success);
+			destination = result.destination;
+		}
+
+		units.resize(units.size() - destination.size());
+		return units;
+	}
+
+	int compare_points(const std::vector<char32_t>& left, const std::vector<char32_t>& right)
+	{
+		if (std::lexicographical_compare(left.begin(), left.end(), right.begin(), right.end()))
+		{
+			return -1;
+		}
+		else if (std::lexicographical_compare(right.begin(), right.end(), left.begin(), left.end()))
+		{
+			return 1;
+		}
+		else
+		{
+			return 0;
+		}
+	}
+
+	using unit_order_test_types = std::tuple<
+		lingo::encoding::utf8<char, char32_t>,
+		lingo::encoding::utf8<unsigned char, char32_t>,
+		lingo::encoding::utf8_se<char16_t, char32_t>,
+		lingo::encoding::utf16<char16_t, char32_t>,
+		lingo::encoding::utf16_se<char16_t, char32_t>,
+		lingo::encoding::utf32<char32_t, char32_t>,
+		lingo::encoding::utf32_se<char32_t, char32_t>>;
+}
+
+TEMPLATE_LIST_TEST_CASE("Comparing units gives the same order as comparing points", "", unit_order_test_types)
+{
+	using encoding_type = TestType;
+	using string_view_type = lingo::basic_string_view<encoding_type, lingo::page::unicode_default>;
+
+	REQUIRE(lingo::encoding::has_unit_order<encoding_type>::value);
+	REQUIRE(noexcept(std::declval<const string_view_type&>().compare(std::declval<string_view_type>())));
+
+	// Points around every boundary where the unit representation changes, including the utf16 surrogate range
+	const std::vector<std::vector<char32_t>> strings =
+	{
+		{},
+		{ U'a' },
+		{ U'a', U'b' },
+		{ U'a', 0x7F },
+		{ U'a', 0x80 },
+		{ U'a', 0x7FF },
+		{ U'a', 0x800 },
+		{ U'a', 0xD7FF },
+		{ U'a', 0xE000 },
+		{ U'a', 0xFF61 },
+		{ U'a', 0xFFFF },
+		{ U'a', 0x10000 },
+		{ U'a', 0x10000, U'a' },
+		{ U'a', 0x1F600 },
+		{ U'a', 0x10FFFF },
+		{ 0xFF61, U'a' },
+		{ 0x10000 },
+	};
+
+	for (const auto& left_points : strings)
+	{
+		const auto left_units = encode_points<encoding_type>(left_points);
+		const string_view_type left(left_units.data(), left_units.size(), false);
+
+		for (const auto& right_points : strings)
+		{
+			const auto right_units = encode_points<encoding_type>(right_points);
+			const string_view_type right(right_units.data(), right_units.size(), false);
+
+			const int expected = compare_points(left_points, right_points);
+			const int result = left.compare(right);
+			REQUIRE(result == expected);
+			REQUIRE((left == right) == (expected == 0));
+			REQUIRE((left != right) == (expected != 0));
+			REQUIRE((left < right) == (expected < 0));
+		}
+	}
+}
+
+TEST_CASE("Comparing long strings finds the first unit that differs")
+{
+	using string_view_type = lingo::basic_string_view<lingo::encoding::utf16<char16_t, char32_t>, lingo::page::unicode_default>;
+
+	std::vector<char16_t> left(1000, u'x');
+	std::vector<char16_t> right(1000, u'x');
+
+	for (std::size_t index : { 0, 31, 32, 63, 64, 500, 999 })
+	{
+		// A surrogate sorts above 0xFF61 as a point, but below it as a unit
+		left[index] = 0xFF61;
+		right[index] = 0xD83D;
+		const string_view_type left_view(left.data(), left.size(), false);
+		const string_view_type right_view(right.data(), right.size(), false);
+
+		REQUIRE(left_view.compare(right_view) < 0);
+		REQUIRE(right_view.compare(left_view) > 0);
+
+		left[index] = u'x';
+		right[index] = u'x';
+	}
+
+	REQUIRE(string_view_type(left.data(), left.size(), false).compare(string_view_type(right.data(), right.size(), false)) == 0);
+	REQUIRE(string_view_type(left.data(), left.size() - 1, false) < string_view_type(right.data(), right.size(), false));
+}
+
+TEST_CASE("Encodings without a unit order are compared by points")
+{
+	REQUIRE_FALSE(lingo::encoding::has_unit_order<lingo::encoding::base64<char, char>>::value);
+	REQUIRE(lingo::encoding::has_unit_order<lingo::encoding::none<char, char>>::value);
+}
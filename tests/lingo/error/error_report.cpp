@@ -0,0 +1,114 @@
+#include <catch/catch.hpp>
+
+#if LINGO_TEST_SPLIT
+#include <lingo/string.hpp>
+#include <lingo/string_converter.hpp>
+
+#include <lingo/encoding/utf8.hpp>
+#include <lingo/encoding/utf32.hpp>
+
+#include <lingo/error/error_report.hpp>
+#include <lingo/error/replace.hpp>
+
+#include <lingo/page/unicode.hpp>
+#else
+#include <lingo/test/include_all.hpp>
+#endif
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace
+{
+	using utf8_encoding = lingo::encoding::utf8<char, char32_t>;
+	using utf32_encoding = lingo::encoding::utf32<char32_t, char32_t>;
+	using unicode_page = lingo::page::unicode_default;
+}
+
+TEST_CASE("error_report stores a bounded number of errors")
+{
+	lingo::error::basic_error_report<2> report;
+	REQUIRE(report.empty());
+	REQUIRE(report.entries().size() == 0);
+
+	report.report(1, lingo::error::error_code::invalid_unit);
+	report.report(5, lingo::error::error_code::no_mapping);
+	report.report(9, lingo::error::error_code::invalid_unit);
+
+	REQUIRE_FALSE(report.empty());
+	REQUIRE(report.total() == 3);
+	REQUIRE(report.dropped() == 1);
+	REQUIRE(report.count(lingo::error::error_code::invalid_unit) == 2);
+	REQUIRE(report.count(lingo::error::error_code::no_mapping) == 1);
+	REQUIRE(report.count(lingo::error::error_code::invalid_point) == 0);
+
+	REQUIRE(report.entries().size() == 2);
+	REQUIRE(report.entries()[0].source_offset == 1);
+	REQUIRE(report.entries()[0].error == lingo::error::error_code::invalid_unit);
+	REQUIRE(report.entries()[1].source_offset == 5);
+	REQUIRE(report.entries()[1].error == lingo::error::error_code::no_mapping);
+
+	report.clear();
+	REQUIRE(report.empty());
+	REQUIRE(report.total() == 0);
+	REQUIRE(report.dropped() == 0);
+	REQUIRE(report.entries().size() == 0);
+	REQUIRE(report.count(lingo::error::error_code::invalid_unit) == 0);
+}
+
+TEST_CASE("string_converter fills an error report")
+{
+	using converter = lingo::string_converter<utf8_encoding, unicode_page, utf32_encoding, unicode_page, lingo::error::replace>;
+
+	// Stray continuation byte, invalid start byte, and a truncated sequence at the end
+	const char source[] = "a\x80" "b\xFF" "c\xE2\x82";
+
+	lingo::error::error_report report;
+	char32_t destination[16] = {};
+	converter().convert(
+		lingo::utility::span<const char>(source, sizeof(source) - 1),
+		lingo::utility::span<char32_t>(destination, 16), true, report);
+
+	REQUIRE(report.total() == 3);
+	REQUIRE(report.entries()[0].source_offset == 1);
+	REQUIRE(report.entries()[0].error == lingo::error::error_code::invalid_unit);
+	REQUIRE(report.entries()[1].source_offset == 3);
+	REQUIRE(report.entries()[1].error == lingo::error::error_code::invalid_unit);
+	REQUIRE(report.entries()[2].source_offset == 5);
+	REQUIRE(report.entries()[2].error == lingo::error::error_code::source_buffer_too_small);
+}
+
+TEST_CASE("string_converter reports every error once when the destination has to grow")
+{
+	using converter = lingo::string_converter<utf32_encoding, unicode_page, utf8_encoding, unicode_page, lingo::error::replace>;
+
+	// Every valid point takes 4 utf8 units and every replacement 3, forcing the destination to grow several times
+	std::vector<char32_t> source;
+	std::vector<std::size_t> invalid_offsets;
+	for (std::size_t i = 0; i < 64; ++i)
+	{
+		if (i % 5 == 3)
+		{
+			invalid_offsets.push_back(i);
+			source.push_back(static_cast<char32_t>(0x110000));
+		}
+		else
+		{
+			source.push_back(U'\U0001F600');
+		}
+	}
+
+	lingo::error::basic_error_report<64> report;
+	const auto string = converter().convert(
+		lingo::basic_string_view<utf32_encoding, unicode_page>(source.data(), source.size()),
+		std::allocator<char>(), report);
+
+	REQUIRE(string.size() == (source.size() - invalid_offsets.size()) * 4 + invalid_offsets.size() * 3);
+	REQUIRE(report.total() == invalid_offsets.size());
+	REQUIRE(report.dropped() == 0);
+	for (std::size_t i = 0; i < invalid_offsets.size(); ++i)
+	{
+		REQUIRE(report.entries()[i].source_offset == invalid_offsets[i]);
+	}
+}
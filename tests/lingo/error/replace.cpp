@@ -0,0 +1,119 @@
+#include <catch/catch.hpp>
+
+#if LINGO_TEST_SPLIT
+#include <lingo/string.hpp>
+#include <lingo/string_converter.hpp>
+
+#include <lingo/encoding/none.hpp>
+#include <lingo/encoding/point_iterator.hpp>
+#include <lingo/encoding/utf8.hpp>
+#include <lingo/encoding/utf32.hpp>
+
+#include <lingo/error/handler_tag.hpp>
+#include <lingo/error/replace.hpp>
+
+#include <lingo/page/ascii.hpp>
+#include <lingo/page/unicode.hpp>
+#else
+#include <lingo/test/include_all.hpp>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace
+{
+	using utf8_encoding = lingo::encoding::utf8<char, char32_t>;
+	using utf32_encoding = lingo::encoding::utf32<char32_t, char32_t>;
+	using ascii_encoding = lingo::encoding::none<char, char>;
+
+	using unicode_page = lingo::page::unicode_default;
+	using ascii_page = lingo::page::ascii;
+
+	using utf8_string_view = lingo::basic_string_view<utf8_encoding, unicode_page>;
+	using utf32_string = lingo::basic_string<utf32_encoding, unicode_page>;
+	using ascii_string = lingo::basic_string<ascii_encoding, ascii_page>;
+}
+
+TEST_CASE("replacement points")
+{
+	REQUIRE(lingo::error::replacement_point<unicode_page, char32_t>::value == U'\uFFFD');
+	REQUIRE(lingo::error::replacement_point<ascii_page, char>::value == '?');
+	REQUIRE(lingo::error::replace<utf8_encoding, unicode_page>::replacement == U'\uFFFD');
+}
+
+TEST_CASE("replace replaces invalid units while converting")
+{
+	// Stray continuation byte, invalid start byte, and a truncated sequence at the end
+	const char source[] = "a\x80" "b\xFF" "c\xE2\x82";
+	const std::vector<char32_t> expected = { U'a', U'\uFFFD', U'b', U'\uFFFD', U'c', U'\uFFFD' };
+
+	SECTION("string_converter")
+	{
+		using converter = lingo::string_converter<utf8_encoding, unicode_page, utf32_encoding, unicode_page, lingo::error::replace>;
+
+		char32_t destination[16] = {};
+		const auto result = converter().convert(
+			lingo::utility::span<const char>(source, sizeof(source) - 1),
+			lingo::utility::span<char32_t>(destination, 16), true);
+
+		REQUIRE(result.source_read == sizeof(source) - 1);
+		REQUIRE(result.destination_written == expected.size());
+		REQUIRE(std::equal(expected.begin(), expected.end(), destination));
+	}
+
+	SECTION("incomplete input")
+	{
+		using converter = lingo::string_converter<utf8_encoding, unicode_page, utf32_encoding, unicode_page, lingo::error::replace>;
+
+		// The truncated sequence is left alone when more input can follow
+		char32_t destination[16] = {};
+		const auto result = converter().convert(
+			lingo::utility::span<const char>(source, sizeof(source) - 1),
+			lingo::utility::span<char32_t>(destination, 16), false);
+
+		REQUIRE(result.source_read == sizeof(source) - 3);
+		REQUIRE(result.destination_written == expected.size() - 1);
+	}
+
+	SECTION("string")
+	{
+		const utf32_string string(utf8_string_view(source, sizeof(source) - 1), lingo::error::handler_tag<lingo::error::replace>());
+
+		REQUIRE(string.size() == expected.size());
+		REQUIRE(std::equal(expected.begin(), expected.end(), string.data()));
+	}
+
+	SECTION("point_iterator")
+	{
+		using point_iterator = lingo::encoding::point_iterator<utf8_encoding, lingo::error::replace<utf8_encoding, unicode_page>>;
+
+		std::vector<char32_t> points;
+		std::copy(point_iterator(utf8_string_view(source, sizeof(source) - 1)), point_iterator(), std::back_inserter(points));
+
+		REQUIRE(points == expected);
+	}
+}
+
+TEST_CASE("replace replaces points that do not exist in the destination page")
+{
+	// "aéb\U0001F600c"
+	const char source_units[] = "a\xC3\xA9" "b\xF0\x9F\x98\x80" "c";
+	const utf8_string_view source(source_units, sizeof(source_units) - 1);
+
+	const ascii_string string(source, lingo::error::handler_tag<lingo::error::replace>());
+
+	REQUIRE(string.size() == 5);
+	REQUIRE(std::equal(string.data(), string.data() + 5, "a?b?c"));
+}
+
+TEST_CASE("strict still throws when a point does not exist in the destination page")
+{
+	// "aéb"
+	const char source_units[] = "a\xC3\xA9" "b";
+	const utf8_string_view source(source_units, sizeof(source_units) - 1);
+
+	REQUIRE_THROWS_AS(ascii_string(source), lingo::error::exception);
+}
@@ -0,0 +1,153 @@
+#include <catch/catch.hpp>
+
+#if LINGO_TEST_SPLIT
+#include <lingo/inplace_string.hpp>
+#include <lingo/point_set.hpp>
+#include <lingo/string.hpp>
+#include <lingo/string_view.hpp>
+#else
+#include <lingo/test/include_all.hpp>
+#endif
+
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+TEST_CASE("inplace_string stores its units inline")
+{
+	using string_type = lingo::utf32_inplace_string<8>;
+	static_assert(string_type::capacity() == 8, "capacity is the template argument");
+	static_assert(std::is_trivially_copyable<string_type>::value, "inplace strings are trivially copyable");
+
+	string_type string(U"abc");
+	REQUIRE(string.size() == 3);
+	REQUIRE(string == lingo::utf32_string_view(U"abc"));
+	REQUIRE(string.c_str()[3] == U'\0');
+
+	string += U'd';
+	string += lingo::utf32_string_view(U"ef");
+	string.append(2, U'!');
+	REQUIRE(string.size() == 8);
+	REQUIRE(string == lingo::utf32_string_view(U"abcdef!!"));
+	REQUIRE(string.find(lingo::utf32_string_view(U"ef")) == 4);
+	REQUIRE(string.ends_with(U"!!"));
+
+	// Arrays of inplace strings can be copied as raw memory
+	string_type copies[2];
+	std::memcpy(copies, &string, sizeof(string_type));
+	std::memcpy(copies + 1, copies, sizeof(string_type));
+	REQUIRE(copies[1] == string);
+
+	const lingo::utf32_string heap_string = string.str();
+	REQUIRE(heap_string == string.view());
+
+	const lingo::utf32_inplace_string<16> larger(string);
+	REQUIRE(larger == string);
+	REQUIRE(larger.capacity() == 16);
+}
+
+TEST_CASE("inplace_string never grows beyond its capacity")
+{
+	lingo::utf32_inplace_string<4> string(U"abcd");
+
+	REQUIRE_THROWS_AS(string.append(lingo::utf32_string_view(U"e")), std::length_error);
+	REQUIRE_THROWS_AS(string += U'e', std::length_error);
+	REQUIRE_THROWS_AS(string.resize(5), std::length_error);
+	REQUIRE_THROWS_AS(lingo::utf32_inplace_string<4>(U"abcde"), std::length_error);
+	REQUIRE(string == lingo::utf32_string_view(U"abcd"));
+
+	string.resize(2);
+	REQUIRE(string == lingo::utf32_string_view(U"ab"));
+	string.clear();
+	REQUIRE(string.empty());
+}
+
+TEST_CASE("inplace_string can truncate at a point boundary")
+{
+	// \u00E9 is two units in UTF-8, so it does not fit in the last unit
+	const lingo::utf8_string_view text(u8"abc\u00E9");
+
+	const auto truncated = lingo::utf8_inplace_string<4>::truncated(text);
+	REQUIRE(truncated.size() == 3);
+	REQUIRE(truncated == lingo::utf8_string_view(u8"abc"));
+
+	const auto fitting = lingo::utf8_inplace_string<5>::truncated(text);
+	REQUIRE(fitting == text);
+}
+
+TEST_CASE("inplace_string can be edited in place")
+{
+	using string_type = lingo::utf32_inplace_string<8>;
+
+	string_type string(U"abcdef");
+	string.insert(2, lingo::utf32_string_view(U"XY"));
+	REQUIRE(string == lingo::utf32_string_view(U"abXYcdef"));
+	REQUIRE(string.c_str()[8] == U'\0');
+	REQUIRE_THROWS_AS(string.insert(0, 1, U'!'), std::length_error);
+	REQUIRE_THROWS_AS(string.insert(9, lingo::utf32_string_view(U"")), std::out_of_range);
+
+	string.erase(2, 2);
+	REQUIRE(string == lingo::utf32_string_view(U"abcdef"));
+	string.erase(string.cbegin());
+	REQUIRE(string == lingo::utf32_string_view(U"bcdef"));
+	string.replace(1, 3, lingo::utf32_string_view(U"1"));
+	REQUIRE(string == lingo::utf32_string_view(U"b1f"));
+	string.replace(0, 1, 3, U'-');
+	REQUIRE(string == lingo::utf32_string_view(U"---1f"));
+	string.insert(string.cbegin() + 3, U'+');
+	REQUIRE(string == lingo::utf32_string_view(U"---+1f"));
+	string.erase(3);
+	REQUIRE(string == lingo::utf32_string_view(U"---"));
+	REQUIRE(string.c_str()[3] == U'\0');
+
+	// Parts of the string itself can be inserted
+	string.assign(lingo::utf32_string_view(U"abcd"));
+	string.insert(1, string.view(), 1, 3);
+	REQUIRE(string == lingo::utf32_string_view(U"abcdbcd"));
+	string.assign(string.view(), 4);
+	REQUIRE(string == lingo::utf32_string_view(U"bcd"));
+	string.append(lingo::utf32_string_view(U"xyz"), 1, 1);
+	REQUIRE(string == lingo::utf32_string_view(U"bcdy"));
+	REQUIRE_THROWS_AS(string.append(lingo::utf32_string_view(U"xyz"), 4), std::out_of_range);
+
+	string.push_back(U'z');
+	REQUIRE(string == lingo::utf32_string_view(U"bcdyz"));
+	string.pop_back();
+	REQUIRE(string == lingo::utf32_string_view(U"bcdy"));
+
+	// Multi unit points are removed as a whole
+	lingo::basic_utf8_inplace_string<char, 8> utf8("a");
+	utf8 += U'é';
+	REQUIRE(utf8.size() == 3);
+	utf8.pop_back();
+	REQUIRE(utf8 == lingo::basic_utf8_string_view<char>("a"));
+}
+
+TEST_CASE("inplace_string can be searched like a string")
+{
+	const lingo::utf32_inplace_string<16> string(U"hello world");
+
+	REQUIRE(string.substr(6) == lingo::utf32_string_view(U"world"));
+	REQUIRE(string.substr(0, 5) == lingo::utf32_string_view(U"hello"));
+	REQUIRE_THROWS_AS(string.substr(12), std::out_of_range);
+
+	char32_t buffer[5] = {};
+	REQUIRE(string.copy(buffer, 5, 6) == 5);
+	REQUIRE(lingo::utf32_string_view(buffer, 5, false) == lingo::utf32_string_view(U"world"));
+
+	REQUIRE(string.compare(U"hello world") == 0);
+	REQUIRE(string.compare(U"hello") > 0);
+	REQUIRE(string.find(U"o") == 4);
+	REQUIRE(string.find(U"o", 5) == 7);
+	REQUIRE(string.find(U"wo!", 0, 2) == 6);
+	REQUIRE(string.rfind(U"o") == 7);
+	REQUIRE(string.rfind(U"o", 6) == 4);
+
+	const lingo::point_set<char32_t> vowels = { U'a', U'e', U'i', U'o', U'u' };
+	REQUIRE(string.find_first_of(vowels) == 1);
+	REQUIRE(string.find_first_of(lingo::utf32_string_view(U"wr")) == 6);
+	REQUIRE(string.find_first_not_of(lingo::utf32_string_view(U"hel")) == 4);
+	REQUIRE(string.find_last_of(vowels) == 7);
+	REQUIRE(string.find_last_not_of(lingo::utf32_string_view(U"dl")) == 8);
+	REQUIRE(string.find_last_not_of(vowels, 2) == 2);
+}
@@ -0,0 +1,106 @@
+#include <catch/catch.hpp>
+
+#if LINGO_TEST_SPLIT
+#include <lingo/interner.hpp>
+#include <lingo/string.hpp>
+#else
+#include <lingo/test/include_all.hpp>
+#endif
+
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	using interner = lingo::basic_utf32_interner<char32_t>;
+	using string = lingo::basic_utf32_string<char32_t>;
+
+	string make_tag(std::size_t index)
+	{
+		string tag(U"tag-");
+		for (const char digit : std::to_string(index))
+		{
+			tag += static_cast<char32_t>(digit);
+		}
+		return tag;
+	}
+}
+
+TEST_CASE("interner deduplicates strings")
+{
+	interner strings;
+	REQUIRE(strings.size() == 0);
+	REQUIRE(strings.find(U"host") == interner::invalid_handle);
+
+	const interner::handle_type host = strings.intern(U"host");
+	const interner::handle_type region = strings.intern(U"region");
+	const interner::handle_type empty = strings.intern(lingo::utf32_string_view());
+	REQUIRE(host != region);
+	REQUIRE(strings.size() == 3);
+
+	// Interning the same units again returns the same handle, even from a different buffer
+	const string host_copy(U"host");
+	REQUIRE(strings.intern(host_copy) == host);
+	REQUIRE(strings.find(host_copy) == host);
+	REQUIRE(strings.size() == 3);
+
+	REQUIRE(strings.view(host) == lingo::utf32_string_view(U"host"));
+	REQUIRE(strings[region] == lingo::utf32_string_view(U"region"));
+	REQUIRE(strings.view(region).null_terminated());
+	REQUIRE(strings.view(empty).empty());
+
+	// Views stay valid while more strings are added
+	const lingo::utf32_string_view host_view = strings.view(host);
+	for (std::size_t i = 0; i < 5000; ++i)
+	{
+		strings.intern(make_tag(i));
+	}
+	REQUIRE(strings.size() == 5003);
+	REQUIRE(strings.view(host).data() == host_view.data());
+
+	for (std::size_t i = 0; i < 5000; i += 123)
+	{
+		const string tag = make_tag(i);
+		const interner::handle_type handle = strings.find(tag);
+		REQUIRE(handle != interner::invalid_handle);
+		REQUIRE(strings.view(handle) == tag);
+	}
+}
+
+TEST_CASE("interner can be used from many threads at once")
+{
+	interner strings;
+	const std::size_t thread_count = 4;
+	const std::size_t tag_count = 2000;
+
+	std::vector<std::vector<interner::handle_type>> handles(thread_count);
+	std::vector<std::thread> threads;
+	for (std::size_t t = 0; t < thread_count; ++t)
+	{
+		threads.emplace_back([&strings, &handles, t, tag_count]()
+		{
+			for (std::size_t i = 0; i < tag_count; ++i)
+			{
+				handles[t].push_back(strings.intern(make_tag(i)));
+			}
+		});
+	}
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	// Every thread received the same handle for the same string
+	REQUIRE(strings.size() == tag_count);
+	for (std::size_t i = 0; i < tag_count; ++i)
+	{
+		for (std::size_t t = 1; t < thread_count; ++t)
+		{
+			REQUIRE(handles[t][i] == handles[0][i]);
+		}
+		REQUIRE(strings.view(handles[0][i]) == make_tag(i));
+	}
+}
@@ -0,0 +1,152 @@
+#include <catch/catch.hpp>
+
+#if LINGO_TEST_SPLIT
+#include <lingo/monotonic_text_arena.hpp>
+#include <lingo/string.hpp>
+#include <lingo/string_builder.hpp>
+#else
+#include <lingo/test/include_all.hpp>
+#endif
+
+#include <lingo/test/counting_allocator.hpp>
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#define LINGO_TEST_PMR 1
+#endif
+#endif
+
+namespace
+{
+	using arena_string = lingo::basic_utf32_string<char32_t, lingo::arena_allocator<char32_t>>;
+
+	// A counting allocator that moves along with the contents of a string
+	template <typename T>
+	struct propagating_allocator : lingo::test::counting_allocator<T>
+	{
+		using propagate_on_container_copy_assignment = std::true_type;
+		using propagate_on_container_move_assignment = std::true_type;
+		using propagate_on_container_swap = std::true_type;
+
+		propagating_allocator() = default;
+
+		template <typename U>
+		propagating_allocator(const propagating_allocator<U>& other) noexcept:
+			lingo::test::counting_allocator<T>(other)
+		{
+		}
+	};
+
+	using propagating_string = lingo::basic_utf32_string<char32_t, propagating_allocator<char32_t>>;
+
+	const char32_t* const long_text = U"a string that is too long for the small string buffer";
+}
+
+TEST_CASE("monotonic_text_arena allocates aligned memory from a few blocks")
+{
+	lingo::monotonic_text_arena arena(64);
+	REQUIRE(arena.block_count() == 0);
+
+	void* const first = arena.allocate(3, 1);
+	void* const second = arena.allocate(8, 8);
+	REQUIRE(first != second);
+	REQUIRE(reinterpret_cast<std::uintptr_t>(second) % 8 == 0);
+	REQUIRE(arena.block_count() == 1);
+
+	// The most recent allocation can be given back
+	arena.deallocate(second, 8);
+	REQUIRE(arena.allocate(8, 8) == second);
+
+	// Large allocations get a block of their own
+	arena.allocate(1000, 16);
+	REQUIRE(arena.block_count() == 2);
+
+	arena.release();
+	REQUIRE(arena.block_count() == 0);
+}
+
+TEST_CASE("strings can be allocated from a monotonic_text_arena")
+{
+	lingo::monotonic_text_arena arena;
+	lingo::monotonic_text_arena other_arena;
+
+	arena_string string(long_text, arena);
+	REQUIRE(string.get_allocator().arena() == &arena);
+	REQUIRE(arena.block_count() == 1);
+
+	// Copies and moves stay in the same arena
+	const arena_string copy(string);
+	REQUIRE(copy.get_allocator().arena() == &arena);
+	REQUIRE(copy == string);
+
+	arena_string moved(std::move(string));
+	REQUIRE(moved.get_allocator().arena() == &arena);
+	REQUIRE(moved == copy);
+	REQUIRE(string.empty());
+
+	// The allocator of an arena string never propagates, so assignments copy into the arena of the target
+	arena_string other(U"x", other_arena);
+	other = copy;
+	REQUIRE(other.get_allocator().arena() == &other_arena);
+	REQUIRE(other == copy);
+
+	other = std::move(moved);
+	REQUIRE(other.get_allocator().arena() == &other_arena);
+	REQUIRE(other == copy);
+	REQUIRE(other_arena.block_count() == 1);
+
+	// A builder can collect its chunks in the arena as well
+	lingo::basic_utf32_string_builder<char32_t, lingo::arena_allocator<char32_t>> builder(arena);
+	builder.append(copy);
+	builder.append(U'!');
+	const arena_string built = builder.build();
+	REQUIRE(built.get_allocator().arena() == &arena);
+	REQUIRE(built.size() == copy.size() + 1);
+}
+
+TEST_CASE("strings propagate allocators that propagate")
+{
+	const propagating_allocator<char32_t> first_allocator;
+	const propagating_allocator<char32_t> second_allocator;
+
+	propagating_string first(long_text, first_allocator);
+	propagating_string second(U"short", second_allocator);
+
+	second = first;
+	REQUIRE(second.get_allocator() == first_allocator);
+	REQUIRE(second == first);
+
+	propagating_string third(U"short", second_allocator);
+	third = std::move(first);
+	REQUIRE(third.get_allocator() == first_allocator);
+	REQUIRE(third == second);
+	REQUIRE(first.empty());
+
+	propagating_string fourth(U"other", second_allocator);
+	swap(third, fourth);
+	REQUIRE(third.get_allocator() == second_allocator);
+	REQUIRE(third == lingo::utf32_string_view(U"other"));
+	REQUIRE(fourth.get_allocator() == first_allocator);
+	REQUIRE(fourth == second);
+}
+
+#ifdef LINGO_TEST_PMR
+TEST_CASE("strings can use polymorphic allocators")
+{
+	using pmr_string = lingo::basic_utf32_string<char32_t, std::pmr::polymorphic_allocator<char32_t>>;
+
+	std::pmr::monotonic_buffer_resource resource;
+	pmr_string string(long_text, &resource);
+	REQUIRE(string.get_allocator().resource() == &resource);
+
+	pmr_string other(U"x");
+	other = string;
+	REQUIRE(other.get_allocator().resource() != &resource);
+	REQUIRE(other == string);
+}
+#endif
@@ -0,0 +1,150 @@
+#include <catch/catch.hpp>
+
+#if LINGO_TEST_SPLIT
+#include <lingo/multi_matcher.hpp>
+#include <lingo/string_view.hpp>
+
+#include <lingo/encoding/utf8.hpp>
+#include <lingo/encoding/utf16.hpp>
+
+#include <lingo/page/unicode.hpp>
+#else
+#include <lingo/test/include_all.hpp>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	using utf8_string_view = lingo::basic_string_view<lingo::encoding::utf8<char, char32_t>, lingo::page::unicode_default>;
+	using utf8_multi_matcher = lingo::multi_matcher<lingo::encoding::utf8<char, char32_t>, lingo::page::unicode_default>;
+
+	using utf16_string_view = lingo::basic_string_view<lingo::encoding::utf16<char16_t, char32_t>, lingo::page::unicode_default>;
+	using utf16_multi_matcher = lingo::multi_matcher<lingo::encoding::utf16<char16_t, char32_t>, lingo::page::unicode_default>;
+
+	using match_list = std::vector<std::pair<std::size_t, std::size_t>>;
+
+	template <typename MultiMatcher, typename StringView>
+	match_list find_matches(const MultiMatcher& matcher, StringView text)
+	{
+		match_list matches;
+		matcher.for_each_match(text, [&](typename MultiMatcher::match_type match)
+		{
+			matches.emplace_back(match.pattern_id, match.offset);
+		});
+		std::sort(matches.begin(), matches.end());
+		return matches;
+	}
+
+	template <typename Unit>
+	match_list find_matches_naive(const std::vector<std::basic_string<Unit>>& patterns, const std::basic_string<Unit>& text)
+	{
+		match_list matches;
+		for (std::size_t pattern_id = 0; pattern_id < patterns.size(); ++pattern_id)
+		{
+			const std::basic_string<Unit>& pattern = patterns[pattern_id];
+			if (pattern.empty())
+			{
+				continue;
+			}
+
+			for (std::size_t offset = text.find(pattern); offset != std::basic_string<Unit>::npos; offset = text.find(pattern, offset + 1))
+			{
+				matches.emplace_back(pattern_id, offset);
+			}
+		}
+		std::sort(matches.begin(), matches.end());
+		return matches;
+	}
+}
+
+TEST_CASE("multi_matcher finds overlapping patterns")
+{
+	const utf8_multi_matcher matcher = { "he", "she", "his", "hers" };
+
+	REQUIRE(matcher.pattern_count() == 4);
+	REQUIRE(find_matches(matcher, utf8_string_view("ushers")) == match_list{ { 0, 2 }, { 1, 1 }, { 3, 2 } });
+	REQUIRE(find_matches(matcher, utf8_string_view("hishe")) == match_list{ { 0, 3 }, { 1, 2 }, { 2, 0 } });
+	REQUIRE(find_matches(matcher, utf8_string_view("xyz")).empty());
+
+	REQUIRE(matcher.contains_match(utf8_string_view("ushers")));
+	REQUIRE_FALSE(matcher.contains_match(utf8_string_view("xyz")));
+	REQUIRE_FALSE(matcher.contains_match(utf8_string_view()));
+}
+
+TEST_CASE("multi_matcher handles empty and duplicate patterns")
+{
+	const utf8_multi_matcher empty_matcher;
+	REQUIRE(empty_matcher.pattern_count() == 0);
+	REQUIRE(find_matches(empty_matcher, utf8_string_view("abc")).empty());
+
+	const utf8_multi_matcher matcher = { "", "ab", "ab", "b" };
+	REQUIRE(find_matches(matcher, utf8_string_view("abab")) == match_list{ { 1, 0 }, { 1, 2 }, { 2, 0 }, { 2, 2 }, { 3, 1 }, { 3, 3 } });
+}
+
+TEST_CASE("multi_matcher finds the same matches as find")
+{
+	const std::string alphabet[] = { "a", "b", "\xC3\xA9", "\xE2\x82\xAC" };
+
+	std::mt19937 random(35);
+	std::uniform_int_distribution<std::size_t> point_distribution(0, 3);
+
+	for (int iteration = 0; iteration < 50; ++iteration)
+	{
+		std::string text;
+		const std::size_t text_size = std::uniform_int_distribution<std::size_t>(0, 200)(random);
+		for (std::size_t i = 0; i < text_size; ++i)
+		{
+			text += alphabet[point_distribution(random)];
+		}
+
+		std::vector<std::string> patterns;
+		const std::size_t pattern_count = std::uniform_int_distribution<std::size_t>(1, 30)(random);
+		for (std::size_t i = 0; i < pattern_count; ++i)
+		{
+			std::string pattern;
+			const std::size_t pattern_size = std::uniform_int_distribution<std::size_t>(1, 6)(random);
+			for (std::size_t j = 0; j < pattern_size; ++j)
+			{
+				pattern += alphabet[point_distribution(random)];
+			}
+			patterns.push_back(pattern);
+		}
+
+		const utf8_multi_matcher matcher(patterns.begin(), patterns.end());
+		const match_list expected = find_matches_naive(patterns, text);
+
+		REQUIRE(find_matches(matcher, utf8_string_view(text.data(), text.size())) == expected);
+		REQUIRE(matcher.contains_match(utf8_string_view(text.data(), text.size())) == !expected.empty());
+
+		// Splitting the text into chunks gives the same matches
+		const std::size_t split = std::uniform_int_distribution<std::size_t>(0, text.size())(random);
+		match_list chunked_matches;
+		utf8_multi_matcher::stream_state state;
+		const auto collect = [&](utf8_multi_matcher::match_type match)
+		{
+			chunked_matches.emplace_back(match.pattern_id, match.offset);
+		};
+		matcher.for_each_match(lingo::utility::span<const char>(text.data(), split), state, collect);
+		matcher.for_each_match(lingo::utility::span<const char>(text.data() + split, text.size() - split), state, collect);
+		std::sort(chunked_matches.begin(), chunked_matches.end());
+
+		REQUIRE(state.offset() == text.size());
+		REQUIRE(chunked_matches == expected);
+	}
+}
+
+TEST_CASE("multi_matcher works with wide units")
+{
+	const std::u16string text = u"x\U0001F600y\u00E9\U0001F600\u20ACy";
+	const std::vector<std::u16string> patterns = { u"\U0001F600", u"\U0001F600y", u"\u00E9\U0001F600\u20AC", u"z" };
+
+	const utf16_multi_matcher matcher(patterns.begin(), patterns.end());
+	REQUIRE(find_matches(matcher, utf16_string_view(text.data(), text.size())) == find_matches_naive(patterns, text));
+	REQUIRE(find_matches(matcher, utf16_string_view(text.data(), text.size())) == match_list{ { 0, 1 }, { 0, 5 }, { 1, 1 }, { 2, 4 } });
+}
@@ -0,0 +1,75 @@
+#include <catch/catch.hpp>
+
+#if LINGO_TEST_SPLIT
+#include <lingo/point_set.hpp>
+#else
+#include <lingo/test/include_all.hpp>
+#endif
+
+TEST_CASE("point_set contains the inserted points")
+{
+	lingo::point_set<char32_t> points;
+	REQUIRE(points.empty());
+	REQUIRE(points.is_ascii());
+	REQUIRE_FALSE(points.contains(U'a'));
+
+	points.insert(U'a');
+	points.insert(U'0', U'9');
+	REQUIRE_FALSE(points.empty());
+	REQUIRE(points.is_ascii());
+	REQUIRE(points.contains(U'a'));
+	REQUIRE(points.contains(U'5'));
+	REQUIRE_FALSE(points.contains(U'b'));
+	REQUIRE_FALSE(points.contains(U'\u00E9'));
+	REQUIRE_FALSE(points.contains(U'\U0001F600'));
+
+	points.insert(U'\u00E9');
+	REQUIRE_FALSE(points.is_ascii());
+	REQUIRE(points.contains(U'\u00E9'));
+	REQUIRE_FALSE(points.contains(U'\u00E8'));
+
+	points.insert(U'\U0001F600');
+	REQUIRE(points.contains(U'\U0001F600'));
+	REQUIRE_FALSE(points.contains(U'\U0001F601'));
+	REQUIRE_FALSE(points.contains(U'\U0001F5FF'));
+}
+
+TEST_CASE("point_set merges ranges of points")
+{
+	lingo::point_set<char32_t> points;
+
+	points.insert(U'\U00020000', U'\U0002000F');
+	points.insert(U'\U00020020', U'\U0002002F');
+	points.insert(U'\U00020010', U'\U0002001F');
+	points.insert(U'\U00010000', U'\U00010000');
+	points.insert(U'\U00030000', U'\U00020FFF');
+
+	REQUIRE(points.contains(U'\U00010000'));
+	REQUIRE_FALSE(points.contains(U'\U00010001'));
+	for (char32_t point = U'\U00020000'; point <= U'\U0002002F'; ++point)
+	{
+		REQUIRE(points.contains(point));
+	}
+	REQUIRE_FALSE(points.contains(U'\U0001FFFF'));
+	REQUIRE_FALSE(points.contains(U'\U00020030'));
+	REQUIRE_FALSE(points.contains(U'\U00030000'));
+
+	// A range that crosses every part of the set
+	lingo::point_set<char32_t> all_points;
+	all_points.insert(U'x', U'\U00010005');
+	REQUIRE_FALSE(all_points.contains(U'w'));
+	REQUIRE(all_points.contains(U'x'));
+	REQUIRE(all_points.contains(U'\u0080'));
+	REQUIRE(all_points.contains(U'\uFFFF'));
+	REQUIRE(all_points.contains(U'\U00010005'));
+	REQUIRE_FALSE(all_points.contains(U'\U00010006'));
+}
+
+TEST_CASE("point_set works with narrow points")
+{
+	const lingo::point_set<char> points = { 'a', static_cast<char>(0xE9) };
+	REQUIRE_FALSE(points.is_ascii());
+	REQUIRE(points.contains('a'));
+	REQUIRE(points.contains(static_cast<char>(0xE9)));
+	REQUIRE_FALSE(points.contains('b'));
+}
@@ -0,0 +1,208 @@
+#include <catch/catch.hpp>
+
+#if LINGO_TEST_SPLIT
+#include <lingo/rope.hpp>
+#include <lingo/string.hpp>
+#include <lingo/string_view.hpp>
+#else
+#include <lingo/test/include_all.hpp>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+	using rope = lingo::basic_utf8_rope<char>;
+	using string_view = lingo::basic_utf8_string_view<char>;
+
+	string_view make_view(const std::string& str)
+	{
+		return string_view(str.data(), str.size(), false);
+	}
+
+	// One, two and three unit points
+	const char* const samples[] = { "a", "\xC3\xA9", "\xE2\x82\xAC", "xyz", "\xE2\x82\xAC\xC3\xA9" };
+	const std::size_t sample_points[] = { 1, 1, 1, 3, 2 };
+}
+
+TEST_CASE("rope can be created from a view")
+{
+	const rope empty;
+	REQUIRE(empty.empty());
+	REQUIRE(empty.size() == 0);
+	REQUIRE(empty.point_count() == 0);
+	REQUIRE(empty.begin() == empty.end());
+	REQUIRE(empty == string_view());
+
+	const rope text("caf\xC3\xA9 \xE2\x82\xAC" "5");
+	REQUIRE(text.size() == 10);
+	REQUIRE(text.point_count() == 7);
+	REQUIRE(text == string_view("caf\xC3\xA9 \xE2\x82\xAC" "5"));
+	REQUIRE(text != string_view("cafe"));
+	REQUIRE(text.str() == string_view("caf\xC3\xA9 \xE2\x82\xAC" "5"));
+	REQUIRE(text[3] == '\xC3');
+	REQUIRE(text.at(9) == '5');
+	REQUIRE_THROWS_AS(text.at(10), std::out_of_range);
+}
+
+TEST_CASE("rope chunks never split a point")
+{
+	std::string expected;
+	for (std::size_t i = 0; i < 1000; ++i)
+	{
+		expected += "\xE2\x82\xAC";
+		if (i % 7 == 0)
+		{
+			expected += "\xC3\xA9";
+		}
+	}
+
+	const rope text(make_view(expected));
+	REQUIRE(text.size() == expected.size());
+	REQUIRE(text.point_count() == 1000 + 143);
+
+	std::size_t chunks = 0;
+	std::size_t units = 0;
+	for (const string_view chunk : text)
+	{
+		// Only the last chunk can be shorter than a full chunk
+		REQUIRE(chunk.size() <= rope::max_chunk_size);
+		REQUIRE((chunk.size() > rope::max_chunk_size - 3 || units + chunk.size() == expected.size()));
+		REQUIRE((static_cast<unsigned char>(chunk.front()) & 0xC0) == 0xC0);
+		REQUIRE(string_view(expected.data() + units, chunk.size(), false) == chunk);
+		units += chunk.size();
+		++chunks;
+	}
+	REQUIRE(units == expected.size());
+	REQUIRE(chunks > 1);
+
+	// Positions inside a point are rejected
+	rope copy(text);
+	REQUIRE_THROWS_AS(copy.insert(1, string_view("x")), std::invalid_argument);
+	REQUIRE_THROWS_AS(copy.erase(2, 1), std::invalid_argument);
+	REQUIRE_THROWS_AS(copy.insert(expected.size() + 1, string_view("x")), std::out_of_range);
+	REQUIRE(copy == text);
+}
+
+TEST_CASE("rope keeps invalid sequences that are split between edits apart")
+{
+	// A lead unit and its continuation unit are two invalid points on their own
+	rope text(string_view("\xC3", 1, false));
+	text.append(string_view("\xA9", 1, false));
+	REQUIRE(text.size() == 2);
+	REQUIRE(text.point_count() == 2);
+	REQUIRE(text.point_index(1) == 1);
+	REQUIRE(text.unit_index(1) == 1);
+	REQUIRE(text.unit_index(2) == 2);
+
+	// The boundary between them stays a valid position
+	text.insert(1, string_view("x"));
+	REQUIRE(text == string_view("\xC3x\xA9", 3, false));
+	REQUIRE(text.point_count() == 3);
+
+	text.erase(1, 1);
+	REQUIRE(text == string_view("\xC3\xA9", 2, false));
+	REQUIRE(text.point_count() == 2);
+	REQUIRE(text.point_index(text.size()) == text.point_count());
+
+	// Valid points are still merged into one chunk
+	rope valid(string_view("\xC3\xA9"));
+	valid.append(string_view("\xC3\xA9"));
+	REQUIRE(valid.point_count() == 2);
+	REQUIRE(std::distance(valid.begin(), valid.end()) == 1);
+}
+
+TEST_CASE("rope can be edited")
+{
+	rope text;
+	std::string expected;
+
+	// A simple linear congruential generator, so that the test is the same on every platform
+	std::uint32_t seed = 12345;
+	const auto next = [&](std::size_t limit) -> std::size_t
+	{
+		seed = seed * 1664525u + 1013904223u;
+		return static_cast<std::size_t>(seed >> 8) % limit;
+	};
+
+	for (std::size_t i = 0; i < 3000; ++i)
+	{
+		const std::size_t point = next(text.point_count() + 1);
+		const std::size_t pos = text.unit_index(point);
+		REQUIRE(text.point_index(pos) == point);
+
+		if (next(4) == 0 && !text.empty())
+		{
+			const std::size_t end = text.unit_index(point + (std::min)(next(4), text.point_count() - point));
+			text.erase(pos, end - pos);
+			expected.erase(pos, end - pos);
+		}
+		else
+		{
+			const std::size_t sample = next(5);
+			const std::size_t points = text.point_count();
+			text.insert(pos, string_view(samples[sample]));
+			expected.insert(pos, samples[sample]);
+			REQUIRE(text.point_count() == points + sample_points[sample]);
+		}
+
+		REQUIRE(text.size() == expected.size());
+	}
+
+	REQUIRE(text == make_view(expected));
+	REQUIRE(text.str() == make_view(expected));
+	REQUIRE(text.point_index(text.size()) == text.point_count());
+	REQUIRE(text.unit_index(text.point_count()) == text.size());
+	REQUIRE_THROWS_AS(text.unit_index(text.point_count() + 1), std::out_of_range);
+
+	// Small edits are merged into the surrounding chunks
+	std::size_t chunks = 0;
+	for (const string_view chunk : text)
+	{
+		static_cast<void>(chunk);
+		++chunks;
+	}
+	REQUIRE(chunks < expected.size() / 64);
+}
+
+TEST_CASE("rope copies and substrings share their chunks")
+{
+	std::string expected;
+	for (std::size_t i = 0; i < 5000; ++i)
+	{
+		expected += static_cast<char>('a' + i % 26);
+	}
+
+	rope text(make_view(expected));
+	const rope copy(text);
+
+	text.erase(100, 4000);
+	text.append(string_view("\xE2\x82\xAC"));
+	REQUIRE(text.size() == 1003);
+	REQUIRE(text.point_count() == 1001);
+	REQUIRE(copy == make_view(expected));
+	REQUIRE(copy != text);
+
+	const rope middle = copy.substr(1000, 2500);
+	REQUIRE(middle == make_view(expected.substr(1000, 2500)));
+	REQUIRE(copy.substr(4990) == make_view(expected.substr(4990)));
+	REQUIRE(copy.substr(5000).empty());
+	REQUIRE_THROWS_AS(copy.substr(5001), std::out_of_range);
+
+	// Ropes with different chunk boundaries compare by their units
+	rope rebuilt = copy.substr(0, 1000);
+	rebuilt += middle;
+	rebuilt += copy.substr(3500);
+	REQUIRE(rebuilt == copy);
+
+	rope joined(make_view(expected.substr(0, 10)));
+	joined.insert(10, copy.substr(10));
+	REQUIRE(joined == copy);
+
+	text.clear();
+	REQUIRE(text.empty());
+}
@@ -0,0 +1,129 @@
+#include <catch/catch.hpp>
+
+#if LINGO_TEST_SPLIT
+#include <lingo/shared_string.hpp>
+#include <lingo/string.hpp>
+#else
+#include <lingo/test/include_all.hpp>
+#endif
+
+#include <lingo/test/counting_allocator.hpp>
+
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	using counting_allocator = lingo::test::counting_allocator<char32_t>;
+	using shared_string = lingo::basic_utf32_shared_string<char32_t, counting_allocator>;
+	using string = lingo::basic_utf32_string<char32_t, counting_allocator>;
+
+	const lingo::utf32_string_view long_text = U"a payload that is too long for the small string buffer of a string";
+}
+
+TEST_CASE("shared_string stores its units in a single allocation")
+{
+	const counting_allocator allocator;
+
+	const shared_string empty;
+	REQUIRE(empty.empty());
+	REQUIRE(empty.use_count() == 0);
+	REQUIRE(empty.view().null_terminated());
+
+	const shared_string str(long_text, allocator);
+	REQUIRE(*allocator.allocations == 1);
+	REQUIRE(str == long_text);
+	REQUIRE(str.size() == long_text.size());
+	REQUIRE(str.view().null_terminated());
+	REQUIRE(str.use_count() == 1);
+}
+
+TEST_CASE("shared_string copies share the same units")
+{
+	const counting_allocator allocator;
+	const shared_string str(long_text, allocator);
+
+	shared_string copy = str;
+	REQUIRE(copy.data() == str.data());
+	REQUIRE(str.use_count() == 2);
+	REQUIRE(*allocator.allocations == 1);
+
+	const shared_string moved = std::move(copy);
+	REQUIRE(copy.empty());
+	REQUIRE(moved.data() == str.data());
+	REQUIRE(str.use_count() == 2);
+
+	// Substrings point into the same buffer
+	const shared_string sub = str.substr(2, 7);
+	REQUIRE(sub == long_text.substr(2, 7));
+	REQUIRE(sub.data() == str.data() + 2);
+	REQUIRE_FALSE(sub.view().null_terminated());
+	REQUIRE(str.use_count() == 3);
+
+	const shared_string tail = str.substr(10);
+	REQUIRE(tail.view().null_terminated());
+	REQUIRE(*allocator.allocations == 1);
+
+	REQUIRE_THROWS_AS(str.substr(long_text.size() + 1), std::out_of_range);
+
+	REQUIRE(str.substr(2, 7) == sub);
+	REQUIRE(str.substr(3) < sub);
+	REQUIRE(long_text.substr(2, 7) == sub);
+}
+
+TEST_CASE("shared_string can take over the buffer of a string and give it back")
+{
+	const counting_allocator allocator;
+	string original(long_text, allocator);
+	const auto* const units = original.data();
+	REQUIRE(*allocator.allocations == 1);
+
+	shared_string str(std::move(original));
+	REQUIRE(str.data() == units);
+	REQUIRE(str == long_text);
+
+	// A shared buffer can not be moved out, so it is copied
+	{
+		const shared_string copy = str;
+		const string copied = std::move(str).str();
+		REQUIRE(copied == long_text);
+		REQUIRE(copied.data() != units);
+		REQUIRE(str.data() == units);
+	}
+
+	// The only owner gives the buffer back
+	const std::size_t allocations = *allocator.allocations;
+	const string result = std::move(str).str();
+	REQUIRE(result.data() == units);
+	REQUIRE(result == long_text);
+	REQUIRE(str.empty());
+	REQUIRE(*allocator.allocations == allocations);
+}
+
+TEST_CASE("shared_string can be copied between threads")
+{
+	const shared_string str(long_text);
+
+	std::vector<std::thread> threads;
+	for (int i = 0; i < 4; ++i)
+	{
+		threads.emplace_back([&str]()
+		{
+			for (int j = 0; j < 1000; ++j)
+			{
+				const shared_string copy = str;
+				const shared_string sub = copy.substr(1);
+				static_cast<void>(sub);
+			}
+		});
+	}
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	REQUIRE(str.use_count() == 1);
+	REQUIRE(str == long_text);
+}
@@ -7,10 +7,13 @@
 #include <lingo/test/include_all.hpp>
 #endif
 
+#include <lingo/test/counting_allocator.hpp>
 #include <lingo/test/test_case.hpp>
 #include <lingo/test/test_strings.hpp>
 #include <lingo/test/test_types.hpp>
 
+#include <cstddef>
+#include <stdexcept>
 #include <tuple>
 
 TEST_CASE("string has the correct types")
@@ -689,6 +692,253 @@ LINGO_UNIT_TEST_CASE("string can be copied to an array")
 	REQUIRE_THROWS_AS(source.copy(nullptr, 0, size + 1), std::out_of_range);
 }
 
+TEST_CASE("string can be searched")
+{
+	const lingo::string text("abcabcabc");
+	const lingo::string pattern("bca");
+	const lingo::string_view pattern_view(pattern);
+
+	REQUIRE(text.find(pattern) == 1);
+	REQUIRE(text.find(pattern, 2) == 4);
+	REQUIRE(text.find(pattern_view) == 1);
+	REQUIRE(text.find(pattern_view, 5) == lingo::string::npos);
+
+	REQUIRE(text.rfind(pattern) == 4);
+	REQUIRE(text.rfind(pattern, 5) == 1);
+	REQUIRE(text.rfind(pattern_view) == 4);
+	REQUIRE(text.rfind(pattern_view, 2) == lingo::string_view::npos);
+}
+
+TEST_CASE("strings of different encodings can be compared")
+{
+	const lingo::utf8_string utf8_string(u8"ab\u00E9\U0001F600");
+	const lingo::utf16_string utf16_string(u"ab\u00E9\U0001F600");
+	const lingo::utf32_string utf32_string(U"ab\u00E9");
+
+	REQUIRE(utf8_string == utf16_string);
+	REQUIRE(utf16_string == utf8_string);
+	REQUIRE(utf8_string != utf32_string);
+	REQUIRE(utf8_string.compare(utf32_string) > 0);
+	REQUIRE(utf32_string.compare(utf16_string.view()) < 0);
+	REQUIRE(utf8_string == utf16_string.view());
+	REQUIRE(utf16_string.view() == utf8_string);
+	REQUIRE(utf32_string.view() != utf8_string);
+}
+
+TEST_CASE("strings of different encodings can be searched")
+{
+	const lingo::utf8_string utf8_string(u8"ab\u00E9\U0001F600ab");
+	const lingo::utf16_string utf16_needle(u"b\u00E9");
+
+	REQUIRE(utf8_string.find(utf16_needle) == 1);
+	REQUIRE(utf8_string.find(utf16_needle.view(), 2) == lingo::utf8_string::npos);
+	REQUIRE(utf8_string.rfind(lingo::utf32_string(U"ab")) == 8);
+	REQUIRE(utf8_string.point_index(8) == 4);
+}
+
+TEST_CASE("string can be resized and overwritten")
+{
+	lingo::utf32_string string(U"abc");
+
+	// Growing keeps the original contents
+	string.resize_and_overwrite(40, [](char32_t* data, std::size_t size)
+	{
+		REQUIRE(size == 40);
+		REQUIRE(data[0] == U'a');
+		REQUIRE(data[2] == U'c');
+		for (std::size_t i = 3; i < size; ++i)
+		{
+			data[i] = U'x';
+		}
+		return size - 5;
+	});
+	REQUIRE(string.size() == 35);
+	REQUIRE(string.data()[35] == U'\0');
+	REQUIRE(string.view().starts_with(U"abcxx"));
+
+	// Shrinking keeps only the units that fit
+	string.resize_and_overwrite(2, [](char32_t* data, std::size_t size)
+	{
+		REQUIRE(data[1] == U'b');
+		return size;
+	});
+	REQUIRE(string == lingo::utf32_string_view(U"ab"));
+
+	// An exception leaves the kept units
+	REQUIRE_THROWS_AS(string.resize_and_overwrite(100, [](char32_t*, std::size_t) -> std::size_t
+	{
+		throw std::runtime_error("failed");
+	}), std::runtime_error);
+	REQUIRE(string == lingo::utf32_string_view(U"ab"));
+}
+
+TEST_CASE("string can be edited in place")
+{
+	using counted_string = lingo::basic_utf32_string<char32_t, lingo::test::counting_allocator<char32_t>>;
+
+	counted_string string(lingo::utf32_string_view(U"the quick brown fox"));
+	string.reserve(64);
+	const char32_t* const buffer = string.data();
+	const std::size_t allocations = *string.get_allocator().allocations;
+
+	// Edits that fit in the capacity do not allocate
+	string.erase(4, 6);
+	REQUIRE(string == lingo::utf32_string_view(U"the brown fox"));
+	string.insert(4, lingo::utf32_string_view(U"lazy "));
+	REQUIRE(string == lingo::utf32_string_view(U"the lazy brown fox"));
+	string.replace(9, 5, lingo::utf32_string_view(U"red"));
+	REQUIRE(string == lingo::utf32_string_view(U"the lazy red fox"));
+	string.replace(0, 3, lingo::utf32_string_view(U"a"));
+	REQUIRE(string == lingo::utf32_string_view(U"a lazy red fox"));
+	string.insert(string.size(), 3, U'!');
+	REQUIRE(string == lingo::utf32_string_view(U"a lazy red fox!!!"));
+	string.erase(string.size() - 2);
+	REQUIRE(string == lingo::utf32_string_view(U"a lazy red fox!"));
+	string.push_back(U'?');
+	string.pop_back();
+	REQUIRE(string == lingo::utf32_string_view(U"a lazy red fox!"));
+	REQUIRE(string.data() == buffer);
+	REQUIRE(string.data()[string.size()] == U'\0');
+	REQUIRE(*string.get_allocator().allocations == allocations);
+
+	// Growing past the capacity allocates once
+	string.replace(2, 4, 60, U'z');
+	REQUIRE(string.size() == 71);
+	REQUIRE(string.view().starts_with(U"a zzzz"));
+	REQUIRE(string.view().ends_with(U"zzzz red fox!"));
+	REQUIRE(string.data()[string.size()] == U'\0');
+	REQUIRE(*string.get_allocator().allocations == allocations + 1);
+
+	// Iterator overloads
+	string.assign(lingo::utf32_string_view(U"abcdef"));
+	auto it = string.erase(string.cbegin() + 1, string.cbegin() + 3);
+	REQUIRE(*it == U'd');
+	REQUIRE(string == lingo::utf32_string_view(U"adef"));
+	it = string.insert(string.cbegin() + 1, U'b');
+	REQUIRE(*it == U'b');
+	it = string.erase(string.cbegin());
+	REQUIRE(*it == U'b');
+	string.replace(string.cbegin(), string.cbegin() + 2, lingo::utf32_string_view(U"xy"));
+	REQUIRE(string == lingo::utf32_string_view(U"xyef"));
+
+	// Parts of the string itself can be inserted
+	string.insert(2, string.view(), 0, 2);
+	REQUIRE(string == lingo::utf32_string_view(U"xyxyef"));
+	string.replace(0, 1, string.view());
+	REQUIRE(string == lingo::utf32_string_view(U"xyxyefyxyef"));
+
+	REQUIRE_THROWS_AS(string.erase(string.size() + 1), std::out_of_range);
+	REQUIRE_THROWS_AS(string.insert(string.size() + 1, lingo::utf32_string_view(U"a")), std::out_of_range);
+	REQUIRE_THROWS_AS(string.replace(0, 1, lingo::utf32_string_view(U"a"), 2), std::out_of_range);
+}
+
+TEST_CASE("string can push and pop points")
+{
+	using string_type = lingo::basic_utf8_string<char>;
+
+	string_type string;
+	string.push_back(U'a');
+	string.push_back(U'\u00E9');
+	string.push_back(U'\u20AC');
+	string.push_back(U'\U0001F600');
+	REQUIRE(string.size() == 10);
+	REQUIRE(string == lingo::basic_utf8_string_view<char>("a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80"));
+
+	// Invalid points are rejected without changing the string
+	REQUIRE_THROWS_AS(string.push_back(char32_t(0x110000)), lingo::error::exception);
+	REQUIRE(string.size() == 10);
+	REQUIRE(string.data()[10] == '\0');
+
+	// Pushing past the small string capacity keeps all points
+	for (std::size_t i = 0; i < 20; ++i)
+	{
+		string.push_back(U'\u20AC');
+	}
+	REQUIRE(string.size() == 70);
+	for (std::size_t i = 0; i < 20; ++i)
+	{
+		string.pop_back();
+	}
+
+	string.pop_back();
+	REQUIRE(string.size() == 6);
+	string.pop_back();
+	REQUIRE(string.size() == 3);
+	string.pop_back();
+	REQUIRE(string.size() == 1);
+	string.pop_back();
+	REQUIRE(string.empty());
+	REQUIRE(string.data()[0] == '\0');
+
+	// A broken point at the end is removed one unit at a time
+	string.append(lingo::basic_utf8_string_view<char>("a\xE2\x82"));
+	string.pop_back();
+	REQUIRE(string == lingo::basic_utf8_string_view<char>("a\xE2"));
+}
+
+TEST_CASE("string can adopt and release buffers")
+{
+	using allocator = std::allocator<char32_t>;
+
+	// An adopted buffer becomes the string without copying, and gets a null terminator
+	allocator buffer_allocator;
+	char32_t* const buffer = buffer_allocator.allocate(65);
+	for (std::size_t i = 0; i < 40; ++i)
+	{
+		buffer[i] = U'a' + static_cast<char32_t>(i % 26);
+	}
+
+	lingo::utf32_string string(U"previous");
+	string.adopt(buffer, 40, 64, buffer_allocator);
+	REQUIRE(string.data() == buffer);
+	REQUIRE(string.size() == 40);
+	REQUIRE(string.capacity() == 64);
+	REQUIRE(string.data()[40] == U'\0');
+	REQUIRE(string.view().starts_with(U"abcdefghijklmnopqrstuvwxyzab"));
+
+	// Appending uses the spare capacity of the buffer
+	string.append(lingo::utf32_string_view(U"xyz"));
+	REQUIRE(string.data() == buffer);
+
+	// Releasing hands the same buffer back and leaves the string empty
+	lingo::utf32_string::buffer_type released = string.release();
+	REQUIRE(released.data == buffer);
+	REQUIRE(released.size == 43);
+	REQUIRE(released.capacity == 64);
+	REQUIRE(released.data[43] == U'\0');
+	REQUIRE(string.empty());
+	REQUIRE(string.data()[0] == U'\0');
+
+	// Buffers can be handed from one string to another
+	lingo::utf32_string other;
+	other.adopt(released.data, released.size, released.capacity);
+	REQUIRE(other.data() == buffer);
+	REQUIRE(other.size() == 43);
+
+	// Short strings are copied into a new buffer on release
+	lingo::utf32_string short_string(U"abc");
+	released = short_string.release();
+	REQUIRE(released.size == 3);
+	REQUIRE(released.capacity == 3);
+	REQUIRE(lingo::utf32_string_view(released.data, released.size, true) == lingo::utf32_string_view(U"abc"));
+	buffer_allocator.deallocate(released.data, released.capacity + 1);
+	REQUIRE(short_string.empty());
+
+	// Buffers from an allocator that cannot free the string's memory are copied and freed
+	lingo::test::counting_allocator<char32_t> foreign_allocator;
+	lingo::basic_utf32_string<char32_t, lingo::test::counting_allocator<char32_t>> counted;
+	char32_t* const foreign_buffer = foreign_allocator.allocate(33);
+	for (std::size_t i = 0; i < 32; ++i)
+	{
+		foreign_buffer[i] = U'x';
+	}
+	counted.adopt(foreign_buffer, 32, 32, foreign_allocator);
+	REQUIRE(counted.data() != foreign_buffer);
+	REQUIRE(counted.size() == 32);
+	REQUIRE(counted.data()[32] == U'\0');
+	REQUIRE(*counted.get_allocator().allocations == 1);
+}
+
 TEST_CASE("A wide string can be converted to a string")
 {
 	const lingo::wide_string wide_string(lingo::test::test_string<wchar_t>::value);
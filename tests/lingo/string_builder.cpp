@@ -0,0 +1,140 @@
+#include <catch/catch.hpp>
+
+#if LINGO_TEST_SPLIT
+#include <lingo/string.hpp>
+#include <lingo/string_builder.hpp>
+#include <lingo/string_view.hpp>
+#else
+#include <lingo/test/include_all.hpp>
+#endif
+
+#include <lingo/test/counting_allocator.hpp>
+
+TEST_CASE("string_builder appends views, strings and points")
+{
+	lingo::utf8_string_builder builder;
+	REQUIRE(builder.empty());
+
+	const lingo::utf8_string name(u8"world");
+	builder.append(lingo::utf8_string_view(u8"Hello"));
+	builder.append(U',');
+	builder.append(U' ');
+	builder.append(name);
+	builder.append(3, U'!');
+	builder.append(U'\u00E9');
+	REQUIRE(builder.size() == 5 + 2 + 5 + 3 + 2);
+
+	REQUIRE(builder.str() == lingo::utf8_string_view(u8"Hello, world!!!\u00E9"));
+	REQUIRE(builder.size() == 17);
+
+	const lingo::utf8_string result = builder.build();
+	REQUIRE(result == lingo::utf8_string_view(u8"Hello, world!!!\u00E9"));
+	REQUIRE(builder.empty());
+
+	REQUIRE_THROWS_AS(builder.append(static_cast<char32_t>(0x110000)), lingo::error::exception);
+}
+
+TEST_CASE("string_builder converts other encodings")
+{
+	lingo::utf8_string_builder builder;
+	builder.append(lingo::utf8_string_view(u8"a"));
+	builder.append(lingo::utf16_string_view(u"b\u00E9\U0001F600"));
+	builder.append(lingo::utf32_string(U"c"));
+
+	REQUIRE(builder.build() == lingo::utf8_string_view(u8"ab\u00E9\U0001F600c"));
+}
+
+TEST_CASE("string_builder builds large strings with a single allocation")
+{
+	using allocator_type = lingo::test::counting_allocator<char32_t>;
+	using builder_type = lingo::basic_utf32_string_builder<char32_t, allocator_type>;
+
+	const allocator_type allocator;
+	builder_type builder(allocator);
+
+	const std::size_t count = builder_type::maximum_chunk_size * 3;
+	lingo::utf32_string expected;
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const char32_t point = U'a' + static_cast<char32_t>(i % 26);
+		builder.append(point);
+		expected.append(1, point);
+
+		// A point converted from another encoding, split over the end of a chunk
+		if (i % 1000 == 0)
+		{
+			builder.append(lingo::utf16_string_view(u"\U0001F600"));
+			expected.append(1, U'\U0001F600');
+		}
+	}
+	REQUIRE(builder.size() == expected.size());
+
+	// Chunks grow with the size of the builder, so only a few chunks and chunk lists are allocated
+	REQUIRE(*allocator.allocations <= 16);
+
+	*allocator.allocations = 0;
+	const auto result = builder.build();
+	REQUIRE(*allocator.allocations == 1);
+	REQUIRE(result.size() == expected.size());
+	REQUIRE(result.view() == expected.view());
+}
+
+TEST_CASE("string_builder grows its list of chunks geometrically")
+{
+	using allocator_type = lingo::test::counting_allocator<char32_t>;
+	using builder_type = lingo::basic_utf32_string_builder<char32_t, allocator_type>;
+
+	const allocator_type allocator;
+	builder_type builder(allocator);
+
+	// Every append fills a chunk of the largest size, so only the list of chunks could add more allocations
+	const lingo::utf32_string part(builder_type::maximum_chunk_size, U'a');
+	const std::size_t count = 500;
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		builder.append(part);
+	}
+	REQUIRE(builder.size() == part.size() * count);
+
+	// One allocation per chunk, and a logarithmic amount for the list
+	REQUIRE(*allocator.allocations < count + 32);
+}
+
+TEST_CASE("string_builder hands a single chunk to the string")
+{
+	using allocator_type = lingo::test::counting_allocator<char32_t>;
+	using builder_type = lingo::basic_utf32_string_builder<char32_t, allocator_type>;
+
+	const allocator_type allocator;
+	builder_type builder(allocator);
+
+	// Reserving the final size up front keeps all units in one chunk, which build() adopts without copying
+	const std::size_t count = builder_type::maximum_chunk_size * 2;
+	builder.reserve(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		builder.append(U'a' + static_cast<char32_t>(i % 26));
+	}
+
+	*allocator.allocations = 0;
+	const auto result = builder.build();
+	REQUIRE(*allocator.allocations <= 16);
+	REQUIRE(result.size() == count);
+	REQUIRE(result.capacity() == count);
+	REQUIRE(result.data()[count] == U'\0');
+	REQUIRE(result.view().starts_with(U"abcdefghijklmnopqrstuvwxyzabc"));
+	REQUIRE(builder.empty());
+}
+
+TEST_CASE("string_builder can be moved")
+{
+	lingo::utf32_string_builder first;
+	first.append(lingo::utf32_string_view(U"abc"));
+
+	lingo::utf32_string_builder second(std::move(first));
+	REQUIRE(second.size() == 3);
+
+	first = std::move(second);
+	first.append(U'd');
+	REQUIRE(first.build() == lingo::utf32_string_view(U"abcd"));
+}
@@ -0,0 +1,90 @@
+#include <catch/catch.hpp>
+
+#if LINGO_TEST_SPLIT
+#include <lingo/string.hpp>
+#include <lingo/string_concatenation.hpp>
+#include <lingo/string_view.hpp>
+#else
+#include <lingo/test/include_all.hpp>
+#endif
+
+#include <lingo/test/counting_allocator.hpp>
+
+TEST_CASE("string_concatenation records its operands")
+{
+	const lingo::utf32_string first(U"Hello");
+	const lingo::utf32_string_view second(U", ");
+	const char32_t third = U'\u00E9';
+
+	const auto concatenation = lingo::concat(first) + second + U"world" + third;
+	REQUIRE(concatenation.size() == 13);
+
+	const lingo::utf32_string result = concatenation;
+	REQUIRE(result == lingo::utf32_string_view(U"Hello, world\u00E9"));
+	REQUIRE(result.data()[result.size()] == U'\0');
+}
+
+TEST_CASE("string_concatenation encodes points")
+{
+	const lingo::utf8_string first(u8"a");
+
+	const auto concatenation = lingo::concat(first) + U'\u00E9' + U'\U0001F600' + first;
+	REQUIRE(concatenation.size() == 1 + 2 + 4 + 1);
+	REQUIRE(concatenation.str() == lingo::utf8_string_view(u8"a\u00E9\U0001F600a"));
+
+	REQUIRE_THROWS_AS(lingo::concat(first) + static_cast<char32_t>(0x110000), lingo::error::exception);
+}
+
+TEST_CASE("string_concatenation allocates once")
+{
+	using allocator_type = lingo::test::counting_allocator<char32_t>;
+	using string_type = lingo::basic_utf32_string<char32_t, allocator_type>;
+
+	const lingo::utf32_string_view part(U"a long enough part to never fit in the small string buffer, ");
+
+	const allocator_type allocator;
+	const string_type result = (lingo::concat(part) + part + U'!' + part + U"done").str(allocator);
+	REQUIRE(*allocator.allocations == 1);
+	REQUIRE(result.size() == part.size() * 3 + 5);
+	REQUIRE(result.view().ends_with(U"!a long enough part to never fit in the small string buffer, done"));
+
+	string_type appended(U"start", allocator);
+	*allocator.allocations = 0;
+	(lingo::concat(part) + part).append_to(appended);
+	REQUIRE(*allocator.allocations == 1);
+	REQUIRE(appended.size() == 5 + part.size() * 2);
+}
+
+TEST_CASE("string_concatenation does not change the binary operators")
+{
+	const lingo::utf32_string first(U"abc");
+	const lingo::utf32_string second(U"def");
+
+	const auto result = first + second;
+	REQUIRE(result.size() == 6);
+	REQUIRE(result == lingo::utf32_string_view(U"abcdef"));
+
+	const lingo::utf32_string concatenated = lingo::concat(first) + second;
+	REQUIRE(concatenated == result);
+}
+
+TEST_CASE("string_concatenation can append a string to itself")
+{
+	using allocator_type = lingo::test::counting_allocator<char32_t>;
+	using string_type = lingo::basic_utf32_string<char32_t, allocator_type>;
+
+	const lingo::utf32_string_view part(U"a long enough part to never fit in the small string buffer, ");
+
+	// The string is reallocated while its own units are still being appended
+	string_type string(part, allocator_type());
+	(lingo::concat(string) + U"and " + string).append_to(string);
+	REQUIRE(string.size() == part.size() * 3 + 4);
+	REQUIRE(string.view().starts_with(part));
+	REQUIRE(string.view().substr(part.size() * 2, 4) == lingo::utf32_string_view(U"and "));
+	REQUIRE(string.view().ends_with(part));
+
+	// Parts of the string work too
+	string_type short_string(U"abc", allocator_type());
+	(lingo::concat(short_string.view().substr(1)) + U'!').append_to(short_string);
+	REQUIRE(short_string == lingo::utf32_string_view(U"abcbc!"));
+}
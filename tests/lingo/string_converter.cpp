@@ -8,4 +8,98 @@
 
 #include <lingo/test/test_case.hpp>
 #include <lingo/test/test_strings.hpp>
-#include <lingo/test/test_types.hpp>
\ No newline at end of file
+#include <lingo/test/test_types.hpp>
+
+#include <cstddef>
+
+namespace
+{
+	// Behaves exactly like utf8, but is a distinct type so the kernel below is only used by this test
+	struct kernel_test_encoding : lingo::encoding::utf8<char, char32_t>
+	{
+	};
+
+	std::size_t kernel_test_calls = 0;
+}
+
+namespace lingo
+{
+	template <>
+	struct converter_kernel<kernel_test_encoding, page::unicode_default, encoding::utf32<char32_t, char32_t>, page::unicode_default>
+	{
+		// Only handles ASCII, and leaves everything else to the generic implementation
+		static conversion_result convert(utility::span<const char> source, utility::span<char32_t> destination, bool)
+		{
+			++kernel_test_calls;
+
+			std::size_t i = 0;
+			for (; i < source.size() && i < destination.size(); ++i)
+			{
+				if (static_cast<unsigned char>(source.data()[i]) >= 0x80)
+				{
+					break;
+				}
+
+				destination.data()[i] = static_cast<char32_t>(source.data()[i]);
+			}
+
+			return { i, i };
+		}
+	};
+}
+
+TEST_CASE("string_converter uses a converter_kernel when one is available")
+{
+	using source_string_view = lingo::basic_string_view<kernel_test_encoding, lingo::page::unicode_default>;
+	using destination_string = lingo::basic_string<lingo::encoding::utf32<char32_t, char32_t>, lingo::page::unicode_default>;
+	using converter = lingo::string_converter<kernel_test_encoding, lingo::page::unicode_default, lingo::encoding::utf32<char32_t, char32_t>, lingo::page::unicode_default>;
+
+	REQUIRE(lingo::has_converter_kernel<kernel_test_encoding, lingo::page::unicode_default, lingo::encoding::utf32<char32_t, char32_t>, lingo::page::unicode_default>::value);
+	REQUIRE_FALSE(lingo::has_converter_kernel<lingo::encoding::utf8<char, char32_t>, lingo::page::unicode_default, lingo::encoding::utf32<char32_t, char32_t>, lingo::page::unicode_default>::value);
+
+	// "abécd\U0001F600e"
+	const char source[] = "ab\xC3\xA9" "cd\xF0\x9F\x98\x80" "e";
+	const char32_t expected[] = { U'a', U'b', U'é', U'c', U'd', U'\U0001F600', U'e' };
+
+	SECTION("span")
+	{
+		kernel_test_calls = 0;
+
+		char32_t destination[16] = {};
+		const auto result = converter().convert(
+			lingo::utility::span<const char>(source, sizeof(source) - 1),
+			lingo::utility::span<char32_t>(destination, 16), true);
+
+		REQUIRE(result.source_read == sizeof(source) - 1);
+		REQUIRE(result.destination_written == 7);
+		REQUIRE(std::equal(expected, expected + 7, destination));
+
+		// The kernel is entered again after every non ASCII point
+		REQUIRE(kernel_test_calls == 3);
+	}
+
+	SECTION("small destination")
+	{
+		kernel_test_calls = 0;
+
+		char32_t destination[3] = {};
+		const auto result = converter().convert(
+			lingo::utility::span<const char>(source, sizeof(source) - 1),
+			lingo::utility::span<char32_t>(destination, 3), true);
+
+		REQUIRE(result.source_read == 4);
+		REQUIRE(result.destination_written == 3);
+		REQUIRE(std::equal(expected, expected + 3, destination));
+	}
+
+	SECTION("string")
+	{
+		kernel_test_calls = 0;
+
+		const destination_string string(source_string_view(source, sizeof(source) - 1));
+
+		REQUIRE(string.size() == 7);
+		REQUIRE(std::equal(expected, expected + 7, string.data()));
+		REQUIRE(kernel_test_calls > 0);
+	}
+}
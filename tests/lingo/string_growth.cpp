@@ -0,0 +1,142 @@
+#include <catch/catch.hpp>
+
+#if LINGO_TEST_SPLIT
+#include <lingo/string.hpp>
+#include <lingo/string_growth.hpp>
+#include <lingo/string_layout.hpp>
+#else
+#include <lingo/test/include_all.hpp>
+#endif
+
+#include <lingo/test/counting_allocator.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace
+{
+	// lingo::string uses char8_t when it is available
+	using char_string = lingo::basic_utf8_string<char>;
+
+	template <typename Layout>
+	using layout_string = lingo::basic_utf8_string<char, lingo::test::counting_allocator<char>, Layout>;
+
+	// An allocator whose strings never allocate more than they need
+	template <typename T>
+	struct exact_allocator : std::allocator<T>
+	{
+		using value_type = T;
+
+		exact_allocator() noexcept = default;
+
+		template <typename U>
+		exact_allocator(const exact_allocator<U>&) noexcept
+		{
+		}
+	};
+
+	template <typename String>
+	void append_units(String& str, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			str += static_cast<char32_t>('a' + (i % 26));
+		}
+	}
+
+	template <typename Layout>
+	void check_shrink_to_fit()
+	{
+		using string_type = layout_string<Layout>;
+
+		const std::size_t short_capacity = string_type().capacity();
+		string_type str;
+		append_units(str, 100);
+		str.reserve(1000);
+		REQUIRE(str.capacity() >= 1000);
+
+		// Shrinking reallocates once to fit the units exactly
+		const std::size_t allocations = *str.get_allocator().allocations;
+		str.shrink_to_fit();
+		REQUIRE(str.capacity() == 100);
+		REQUIRE(str.size() == 100);
+		REQUIRE(str.data()[100] == '\0');
+		REQUIRE(str.view().starts_with(lingo::basic_utf8_string_view<char>("abcdefghij")));
+		REQUIRE(*str.get_allocator().allocations == allocations + 1);
+
+		// Shrinking again does nothing
+		str.shrink_to_fit();
+		REQUIRE(*str.get_allocator().allocations == allocations + 1);
+
+		// Short enough strings move back into the small string buffer without allocating
+		str.erase(5);
+		str.shrink_to_fit();
+		REQUIRE(str.capacity() == short_capacity);
+		REQUIRE(str == lingo::basic_utf8_string_view<char>("abcde"));
+		REQUIRE(str.data()[5] == '\0');
+		REQUIRE(*str.get_allocator().allocations == allocations + 1);
+
+		// And can grow again afterwards
+		append_units(str, 100);
+		REQUIRE(str.size() == 105);
+		REQUIRE(str.view().starts_with(lingo::basic_utf8_string_view<char>("abcdeabcde")));
+	}
+}
+
+namespace lingo
+{
+	template <typename T>
+	struct string_growth_traits<exact_allocator<T>>
+	{
+		using policy_type = string_growth::exact;
+	};
+}
+
+TEST_CASE("string growth policies calculate the new capacity")
+{
+	const std::size_t max = static_cast<std::size_t>(-1);
+
+	// Geometric growth, or the requested capacity if that is larger
+	REQUIRE(lingo::string_growth::geometric<>::grow<char>(100, 101, max, 1) == 200);
+	REQUIRE(lingo::string_growth::geometric<>::grow<char>(100, 300, max, 1) == 300);
+	REQUIRE(lingo::string_growth::geometric<3, 2>::grow<char>(100, 101, max, 1) == 150);
+	REQUIRE(lingo::string_growth::geometric<>::grow<char>(max / 2 + 1, max / 2 + 2, max, 1) == max);
+	REQUIRE(lingo::string_growth::geometric<>::fit<char>(100, max, 1) == 100);
+
+	REQUIRE(lingo::string_growth::exact::grow<char>(100, 101, max, 1) == 101);
+	REQUIRE(lingo::string_growth::exact::fit<char>(100, max, 1) == 100);
+
+	// Small allocations are rounded to multiples of 16 bytes, larger ones to quarters of a power of two
+	using size_classes = lingo::string_growth::size_classes<lingo::string_growth::exact, 16>;
+	REQUIRE(size_classes::grow<char>(0, 20, max, 1) == 31);
+	REQUIRE(size_classes::grow<char>(0, 31, max, 1) == 31);
+	REQUIRE(size_classes::grow<char>(0, 100, max, 1) == 111);
+	REQUIRE(size_classes::grow<char>(0, 130, max, 1) == 159);
+	REQUIRE(size_classes::grow<char32_t>(0, 30, max, 1) == 31);
+	REQUIRE(size_classes::grow<char>(0, 20, max, 9) == 23);
+	REQUIRE(size_classes::grow<char>(0, 20, 25, 1) == 25);
+	REQUIRE(size_classes::fit<char>(100, max, 1) == 111);
+}
+
+TEST_CASE("string growth policy can be chosen per allocator")
+{
+	using exact_string = lingo::basic_utf8_string<char, exact_allocator<char>>;
+
+	exact_string str;
+	append_units(str, 40);
+	REQUIRE(str.capacity() == 40);
+	str += U'x';
+	REQUIRE(str.capacity() == 41);
+
+	// Other strings keep doubling
+	char_string doubling;
+	append_units(doubling, 40);
+	REQUIRE(doubling.capacity() > 41);
+}
+
+TEST_CASE("string can shrink to fit")
+{
+	check_shrink_to_fit<lingo::string_layout::standard>();
+	check_shrink_to_fit<lingo::string_layout::compact>();
+	check_shrink_to_fit<lingo::string_layout::inline_buffer<64>>();
+}
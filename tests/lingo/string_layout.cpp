@@ -0,0 +1,192 @@
+#include <catch/catch.hpp>
+
+#if LINGO_TEST_SPLIT
+#include <lingo/error/error_report.hpp>
+#include <lingo/string.hpp>
+#include <lingo/string_converter.hpp>
+#include <lingo/string_layout.hpp>
+#else
+#include <lingo/test/include_all.hpp>
+#endif
+
+#include <lingo/test/counting_allocator.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+namespace
+{
+	// lingo::string uses char8_t when it is available
+	using char_string = lingo::basic_utf8_string<char>;
+
+	template <typename Layout>
+	using layout_string = lingo::basic_utf8_string<char, lingo::test::counting_allocator<char>, Layout>;
+
+	template <typename Layout>
+	using layout_utf16_string = lingo::basic_utf16_string<char16_t, lingo::internal::default_allocator<lingo::encoding::utf16<char16_t, char32_t>>, Layout>;
+
+	// Builds a string of count units that do not repeat too often
+	template <typename String>
+	String make_string(std::size_t count)
+	{
+		String result;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			result += static_cast<char32_t>('a' + (i % 26));
+		}
+		return result;
+	}
+}
+
+namespace
+{
+	// A layout that can only store a few units, like string_layout::compact can only store a limited size
+	struct limited_layout
+	{
+	};
+}
+
+namespace lingo
+{
+	namespace internal
+	{
+		template <typename Unit>
+		struct basic_string_storage_layout<Unit, limited_layout> : basic_string_storage_inline_layout<Unit, sizeof(void*) * 4>
+		{
+			static std::size_t max_size() noexcept
+			{
+				return 100;
+			}
+		};
+	}
+}
+
+TEST_CASE("string layouts have the correct size")
+{
+	REQUIRE(sizeof(char_string) == sizeof(void*) * 4);
+	REQUIRE(sizeof(lingo::basic_utf8_string<char, char_string::allocator_type, lingo::string_layout::compact>) == sizeof(void*) * 2);
+	REQUIRE(sizeof(layout_utf16_string<lingo::string_layout::compact>) == sizeof(void*) * 2);
+	REQUIRE(sizeof(lingo::basic_utf8_string<char, char_string::allocator_type, lingo::string_layout::inline_buffer<64>>) == 64);
+	REQUIRE(sizeof(layout_utf16_string<lingo::string_layout::inline_buffer<64>>) == 64);
+
+	REQUIRE(char_string().capacity() == sizeof(void*) * 4 - 1);
+	REQUIRE(layout_string<lingo::string_layout::compact>().capacity() == sizeof(void*) * 2 - 1);
+	REQUIRE(layout_string<lingo::string_layout::inline_buffer<64>>().capacity() == 63);
+	REQUIRE(layout_utf16_string<lingo::string_layout::compact>().capacity() == sizeof(void*) - 1);
+}
+
+TEMPLATE_TEST_CASE("strings only allocate when they outgrow the small string buffer of their layout", "",
+	lingo::string_layout::standard, lingo::string_layout::compact, lingo::string_layout::inline_buffer<64>)
+{
+	using string_type = layout_string<TestType>;
+
+	string_type string;
+	const std::size_t short_capacity = string.capacity();
+	const std::shared_ptr<std::size_t> allocations = string.get_allocator().allocations;
+
+	string = make_string<char_string>(short_capacity).view();
+	REQUIRE(string.size() == short_capacity);
+	REQUIRE(*allocations == 0);
+
+	// Long enough for the compact layout to need more than one byte for the size
+	string = make_string<char_string>(300).view();
+	REQUIRE(string.size() == 300);
+	REQUIRE(string.capacity() >= 300);
+	REQUIRE(string.data()[300] == '\0');
+	REQUIRE(*allocations == 1);
+	REQUIRE(string == make_string<char_string>(300).view());
+
+	string.resize(short_capacity + 1);
+	REQUIRE(string.size() == short_capacity + 1);
+	REQUIRE(*allocations == 1);
+}
+
+TEMPLATE_TEST_CASE("strings can be copied, moved and swapped in every layout", "",
+	lingo::string_layout::standard, lingo::string_layout::compact, lingo::string_layout::inline_buffer<64>)
+{
+	using string_type = layout_utf16_string<TestType>;
+
+	const string_type short_string = make_string<string_type>(3);
+	const string_type long_string = make_string<string_type>(1000);
+	REQUIRE(long_string.size() == 1000);
+
+	string_type copy(long_string);
+	REQUIRE(copy == long_string);
+
+	string_type moved(std::move(copy));
+	REQUIRE(moved == long_string);
+	REQUIRE(copy.empty());
+
+	copy = short_string;
+	REQUIRE(copy == short_string);
+
+	copy = std::move(moved);
+	REQUIRE(copy == long_string);
+	REQUIRE(moved.empty());
+
+	string_type other = short_string;
+	swap(copy, other);
+	REQUIRE(copy == short_string);
+	REQUIRE(other == long_string);
+
+	// Strings of different layouts can be compared and concatenated
+	const lingo::utf16_string standard = make_string<lingo::utf16_string>(1000);
+	REQUIRE(other == standard);
+	REQUIRE(standard == other);
+
+	const string_type concatenated = short_string + standard;
+	REQUIRE(concatenated.size() == 1003);
+	REQUIRE(concatenated.view().substr(3) == standard.view());
+}
+
+TEST_CASE("strings can be converted into a different layout")
+{
+	const char_string standard = make_string<char_string>(100);
+
+	const layout_string<lingo::string_layout::compact> compact(standard);
+	REQUIRE(compact == standard);
+
+	const lingo::basic_utf16_string<char16_t, lingo::internal::default_allocator<lingo::encoding::utf16<char16_t, char32_t>>, lingo::string_layout::compact> converted(standard);
+	REQUIRE(converted.size() == 100);
+	REQUIRE(converted == make_string<lingo::utf16_string>(100));
+
+	// Conversions that report their errors can choose the layout too
+	using converter = lingo::string_converter<
+		lingo::encoding::utf8<char, char32_t>, lingo::page::unicode_default,
+		lingo::encoding::utf16<char16_t, char32_t>, lingo::page::unicode_default>;
+	using allocator_type = lingo::internal::default_allocator<lingo::encoding::utf16<char16_t, char32_t>>;
+
+	lingo::error::error_report report;
+	const layout_utf16_string<lingo::string_layout::compact> reported = converter().convert<allocator_type, lingo::string_layout::compact>(standard.view(), allocator_type(), report);
+	REQUIRE(reported == converted);
+	REQUIRE(report.empty());
+}
+
+TEST_CASE("strings can not grow beyond the maximum size of their layout")
+{
+	using string_type = layout_string<limited_layout>;
+
+	REQUIRE(layout_string<lingo::string_layout::compact>().max_size() == (std::size_t(1) << (8 * (sizeof(void*) - 1))) - 1);
+
+	string_type string = make_string<char_string>(100).view();
+	REQUIRE(string.max_size() == 100);
+	REQUIRE(string.size() == 100);
+
+	// Nothing changes when growing fails
+	REQUIRE_THROWS_AS(string.append(lingo::basic_utf8_string_view<char>("a")), std::length_error);
+	REQUIRE_THROWS_AS(string.push_back(U'a'), std::length_error);
+	REQUIRE_THROWS_AS(string.insert(0, 1, U'a'), std::length_error);
+	REQUIRE_THROWS_AS(string.resize(101), std::length_error);
+	REQUIRE_THROWS_AS(string.reserve(101), std::length_error);
+	REQUIRE_THROWS_AS(string.append(static_cast<std::size_t>(-1) / 2, U'a'), std::length_error);
+	REQUIRE_THROWS_AS(string.assign(static_cast<std::size_t>(-1) / 2, U'\u00E9'), std::length_error);
+	REQUIRE_THROWS_AS(string.replace(0, 1, static_cast<std::size_t>(-1) / 2, U'\u00E9'), std::length_error);
+	REQUIRE_THROWS_AS(string_type(make_string<char_string>(101).view()), std::length_error);
+	REQUIRE(string == make_string<char_string>(100).view());
+
+	// Replacing units with as many units still fits
+	string.replace(0, 2, lingo::basic_utf8_string_view<char>("zz"));
+	REQUIRE(string.size() == 100);
+	REQUIRE(string.view().starts_with(lingo::basic_utf8_string_view<char>("zzc")));
+}
@@ -2,6 +2,10 @@
 
 #if LINGO_TEST_SPLIT
 #include <lingo/string_view.hpp>
+
+#include <lingo/error/exception.hpp>
+
+#include <lingo/page/iso_8859.hpp>
 #else
 #include <lingo/test/include_all.hpp>
 #endif
@@ -9,7 +13,10 @@
 #include <lingo/test/test_case.hpp>
 #include <lingo/test/test_strings.hpp>
 
+#include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 LINGO_UNIT_TEST_CASE("string_view has the correct exception specifications")
 {
@@ -515,4 +522,246 @@ TEST_CASE("string_view can be searched")
 	REQUIRE_FALSE(text.ends_with(string_view_type("aatacaaaaaattagccaggcatggtggctggtggctatagtcccagcta")));
 
 
-}
\ No newline at end of file
+}
+
+namespace
+{
+	template <typename StringView>
+	std::vector<std::pair<std::size_t, typename StringView::point_type>> decode_points(StringView text)
+	{
+		std::vector<std::pair<std::size_t, typename StringView::point_type>> points;
+		for (lingo::encoding::point_iterator<typename StringView::encoding_type> it(text), last; it != last; ++it)
+		{
+			points.emplace_back(static_cast<std::size_t>(it.read_ptr() - text.data()), *it);
+		}
+		return points;
+	}
+
+	template <typename StringView>
+	void test_find_of(StringView text, const lingo::point_set<typename StringView::point_type>& points)
+	{
+		const auto decoded = decode_points(text);
+
+		for (const auto& start : decoded)
+		{
+			std::size_t first_of = StringView::npos;
+			std::size_t first_not_of = StringView::npos;
+			for (const auto& point : decoded)
+			{
+				if (point.first >= start.first)
+				{
+					if (first_of == StringView::npos && points.contains(point.second))
+					{
+						first_of = point.first;
+					}
+					if (first_not_of == StringView::npos && !points.contains(point.second))
+					{
+						first_not_of = point.first;
+					}
+				}
+			}
+
+			std::size_t last_of = StringView::npos;
+			std::size_t last_not_of = StringView::npos;
+			for (const auto& point : decoded)
+			{
+				if (point.first <= start.first)
+				{
+					if (points.contains(point.second))
+					{
+						last_of = point.first;
+					}
+					else
+					{
+						last_not_of = point.first;
+					}
+				}
+			}
+
+			REQUIRE(text.find_first_of(points, start.first) == first_of);
+			REQUIRE(text.find_first_not_of(points, start.first) == first_not_of);
+			REQUIRE(text.find_last_of(points, start.first) == last_of);
+			REQUIRE(text.find_last_not_of(points, start.first) == last_not_of);
+		}
+
+		REQUIRE(text.find_first_of(points, text.size()) == StringView::npos);
+		REQUIRE(text.find_first_not_of(points, text.size()) == StringView::npos);
+
+		std::size_t last_of = StringView::npos;
+		std::size_t last_not_of = StringView::npos;
+		for (const auto& point : decoded)
+		{
+			(points.contains(point.second) ? last_of : last_not_of) = point.first;
+		}
+		REQUIRE(text.find_last_of(points) == last_of);
+		REQUIRE(text.find_last_not_of(points) == last_not_of);
+	}
+}
+
+TEST_CASE("string_view can find the first and last of a set of points")
+{
+	using utf8_string_view = lingo::basic_utf8_string_view<char>;
+
+	const lingo::point_set<char32_t> ascii_points = { U' ', U'\t', U',' };
+	const lingo::point_set<char32_t> mixed_points = { U' ', U'\u00E9', U'\U0001F600' };
+	const lingo::point_set<char32_t> no_points;
+
+	const char utf8_units[] = " a,\xC3\xA9\tb \xF0\x9F\x98\x80\xE2\x82\xAC,c ";
+	const utf8_string_view utf8_text(utf8_units, sizeof(utf8_units) - 1);
+	test_find_of(utf8_text, ascii_points);
+	test_find_of(utf8_text, mixed_points);
+	test_find_of(utf8_text, no_points);
+
+	const char16_t utf16_units[] = u" a,\u00E9\tb \U0001F600\u20AC,c ";
+	const lingo::utf16_string_view utf16_text(utf16_units, sizeof(utf16_units) / sizeof(utf16_units[0]) - 1);
+	test_find_of(utf16_text, ascii_points);
+	test_find_of(utf16_text, mixed_points);
+	test_find_of(utf16_text, no_points);
+
+	test_find_of(utf8_string_view(), ascii_points);
+	test_find_of(lingo::ascii_string_view("  trim me  "), lingo::point_set<char>{ ' ' });
+
+	SECTION("Sets can be given as strings")
+	{
+		const utf8_string_view text("  key = value\t");
+		REQUIRE(text.find_first_not_of(" \t") == 2);
+		REQUIRE(text.find_first_of("=") == 6);
+		REQUIRE(text.find_last_not_of(" \t") == 12);
+		REQUIRE(text.find_last_of(" ", 7) == 7);
+		REQUIRE(text.find_first_of("xz!") == utf8_string_view::npos);
+
+		const lingo::utf8_string string("  key = value\t");
+		REQUIRE(string.find_first_not_of(" \t") == 2);
+		REQUIRE(string.find_last_not_of(lingo::point_set<char32_t>{ U' ', U'\t' }) == 12);
+	}
+}
+
+TEST_CASE("string_view stops searching for points at an invalid point")
+{
+	using utf8_string_view = lingo::basic_utf8_string_view<char>;
+
+	// Sets with only ASCII points are searched without decoding, but must find the same points as other sets
+	const lingo::point_set<char32_t> ascii_points = { U'b' };
+	const lingo::point_set<char32_t> mixed_points = { U'b', U'\u00E9' };
+
+	const utf8_string_view text("a\xFF" "b");
+	for (const auto* points : { &ascii_points, &mixed_points })
+	{
+		REQUIRE(text.find_first_of(*points) == utf8_string_view::npos);
+		REQUIRE(text.find_first_not_of(*points) == 0);
+		REQUIRE(text.find_first_not_of(*points, 1) == utf8_string_view::npos);
+		REQUIRE(text.find_first_of(*points, 2) == 2);
+		REQUIRE(text.find_last_of(*points) == 2);
+		REQUIRE(text.find_last_of(*points, 0) == utf8_string_view::npos);
+		REQUIRE(text.find_last_not_of(*points) == utf8_string_view::npos);
+		REQUIRE(text.find_last_not_of(*points, 0) == 0);
+	}
+
+	// An invalid point behind a point above ASCII
+	const utf8_string_view mixed_text("\xC3\xA9" "a\xC3" "b");
+	for (const auto* points : { &ascii_points, &mixed_points })
+	{
+		REQUIRE(mixed_text.find_first_of(*points) == (points == &mixed_points ? 0 : utf8_string_view::npos));
+		REQUIRE(mixed_text.find_last_of(*points) == 4);
+		REQUIRE(mixed_text.find_last_of(*points, 2) == (points == &mixed_points ? 0 : utf8_string_view::npos));
+	}
+}
+
+TEST_CASE("string_views of different encodings and pages can be compared")
+{
+	using utf8_string_view = lingo::basic_utf8_string_view<char>;
+	using iso_8859_1_string_view = lingo::basic_string_view<lingo::encoding::none<unsigned char, unsigned char>, lingo::page::iso_8859_1>;
+
+	const char utf8_units[] = "ab\xC3\xA9\xF0\x9F\x98\x80" "c";
+	const char16_t utf16_units[] = u"ab\u00E9\U0001F600c";
+	const char32_t utf32_units[] = U"ab\u00E9\U0001F600c";
+
+	const utf8_string_view utf8_text(utf8_units, sizeof(utf8_units) - 1);
+	const lingo::utf16_string_view utf16_text(utf16_units, sizeof(utf16_units) / sizeof(utf16_units[0]) - 1);
+	const lingo::utf32_string_view utf32_text(utf32_units, sizeof(utf32_units) / sizeof(utf32_units[0]) - 1);
+
+	SECTION("Equal strings")
+	{
+		REQUIRE(utf8_text.compare(utf16_text) == 0);
+		REQUIRE(utf16_text.compare(utf8_text) == 0);
+		REQUIRE(utf8_text.compare(utf32_text) == 0);
+		REQUIRE(utf8_text == utf16_text);
+		REQUIRE(utf16_text == utf32_text);
+		REQUIRE_FALSE(utf8_text != utf16_text);
+	}
+
+	SECTION("Strings are ordered by their points")
+	{
+		// U+FFFD is smaller than U+1F600, even though its UTF-16 unit is larger than a surrogate
+		const char16_t replacement_units[] = u"ab\u00E9\uFFFD";
+		const lingo::utf16_string_view replacement_text(replacement_units, sizeof(replacement_units) / sizeof(replacement_units[0]) - 1);
+		REQUIRE(utf8_text.compare(replacement_text) > 0);
+		REQUIRE(replacement_text.compare(utf8_text) < 0);
+		REQUIRE(utf8_text != replacement_text);
+
+		REQUIRE(utf8_text.compare(lingo::utf16_string_view(utf16_units, 3)) > 0);
+		REQUIRE(lingo::utf16_string_view(utf16_units, 3).compare(utf8_text) < 0);
+		REQUIRE(utf8_text.compare(lingo::utf16_string_view(u"ac")) < 0);
+		REQUIRE(utf8_string_view().compare(lingo::utf16_string_view()) == 0);
+		REQUIRE(utf8_string_view().compare(utf16_text) < 0);
+	}
+
+	SECTION("Points of different pages are mapped before comparing")
+	{
+		const unsigned char iso_units[] = { 'a', 'b', 0xE9 };
+		const iso_8859_1_string_view iso_text(iso_units, 3);
+		REQUIRE(iso_text == utf8_string_view("ab\xC3\xA9"));
+		REQUIRE(utf8_string_view("ab\xC3\xA9") == iso_text);
+		REQUIRE(iso_text.compare(utf16_text) < 0);
+		REQUIRE(lingo::ascii_string_view("ab") == lingo::utf16_string_view(u"ab"));
+	}
+
+	SECTION("Invalid points throw")
+	{
+		const char invalid_units[] = "ab\xC3";
+		REQUIRE_THROWS_AS(utf8_string_view(invalid_units, 3).compare(utf16_text), lingo::error::exception);
+	}
+}
+
+TEST_CASE("string_view can find strings of other encodings")
+{
+	using utf8_string_view = lingo::basic_utf8_string_view<char>;
+
+	// "a\u00E9b\U0001F600a\u00E9b"
+	const char utf8_units[] = "a\xC3\xA9" "b\xF0\x9F\x98\x80" "a\xC3\xA9" "b";
+	const utf8_string_view utf8_text(utf8_units, sizeof(utf8_units) - 1);
+	const char16_t utf16_units[] = u"a\u00E9b\U0001F600a\u00E9b";
+	const lingo::utf16_string_view utf16_text(utf16_units, sizeof(utf16_units) / sizeof(utf16_units[0]) - 1);
+
+	REQUIRE(utf8_text.find(lingo::utf16_string_view(u"\u00E9b")) == 1);
+	REQUIRE(utf8_text.find(lingo::utf16_string_view(u"\u00E9b"), 2) == 9);
+	REQUIRE(utf8_text.rfind(lingo::utf16_string_view(u"\u00E9b")) == 9);
+	REQUIRE(utf8_text.find(lingo::utf32_string_view(U"\U0001F600")) == 4);
+	REQUIRE(utf8_text.find(lingo::utf32_string_view(U"\U0001F601")) == utf8_string_view::npos);
+
+	REQUIRE(utf16_text.find(utf8_string_view("b\xF0\x9F\x98\x80")) == 2);
+	REQUIRE(utf16_text.rfind(utf8_string_view("a")) == 5);
+	REQUIRE(utf16_text.find(utf8_string_view("")) == 0);
+
+	// Invalid needles are never found
+	REQUIRE(utf8_text.find(lingo::utf16_string_view(u"\xD800")) == utf8_string_view::npos);
+
+	// Needles that do not fit in the inline buffer
+	const std::u32string long_needle(100, U'\u00E9');
+	std::string long_units = "xx";
+	for (int i = 0; i < 101; ++i)
+	{
+		long_units += "\xC3\xA9";
+	}
+	const utf8_string_view long_text(long_units.data(), long_units.size());
+	REQUIRE(long_text.find(lingo::utf32_string_view(long_needle.data(), long_needle.size())) == 2);
+	REQUIRE(long_text.rfind(lingo::utf32_string_view(long_needle.data(), long_needle.size())) == 4);
+
+	SECTION("Offsets can be converted to point indices")
+	{
+		REQUIRE(utf8_text.point_index(0) == 0);
+		REQUIRE(utf8_text.point_index(utf8_text.find(lingo::utf16_string_view(u"\u00E9b"), 2)) == 5);
+		REQUIRE(utf8_text.point_index(utf8_text.size()) == 7);
+		REQUIRE(utf16_text.point_index(utf16_text.find(utf8_string_view("a"), 1)) == 4);
+	}
+}
@@ -0,0 +1,58 @@
+#ifndef H_LINGO_TEST_COUNTING_ALLOCATOR
+#define H_LINGO_TEST_COUNTING_ALLOCATOR
+
+#include <cstddef>
+#include <memory>
+
+namespace lingo
+{
+	namespace test
+	{
+		// Counts the allocations made through it, the count is shared between copies
+		template <typename T>
+		struct counting_allocator
+		{
+			using value_type = T;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+
+			counting_allocator():
+				allocations(std::make_shared<std::size_t>(0))
+			{
+			}
+
+			template <typename U>
+			counting_allocator(const counting_allocator<U>& other) noexcept:
+				allocations(other.allocations)
+			{
+			}
+
+			T* allocate(std::size_t n)
+			{
+				++*allocations;
+				return std::allocator<T>().allocate(n);
+			}
+
+			void deallocate(T* p, std::size_t n) noexcept
+			{
+				std::allocator<T>().deallocate(p, n);
+			}
+
+			template <typename U>
+			bool operator == (const counting_allocator<U>& other) const noexcept
+			{
+				return allocations == other.allocations;
+			}
+
+			template <typename U>
+			bool operator != (const counting_allocator<U>& other) const noexcept
+			{
+				return allocations != other.allocations;
+			}
+
+			std::shared_ptr<std::size_t> allocations;
+		};
+	}
+}
+
+#endif
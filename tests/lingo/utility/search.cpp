@@ -0,0 +1,114 @@
+#include <catch/catch.hpp>
+
+#if LINGO_TEST_SPLIT
+#include <lingo/utility/search.hpp>
+#else
+#include <lingo/test/include_all.hpp>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace
+{
+	template <typename Item>
+	std::size_t reference_search(const std::vector<Item>& haystack, const std::vector<Item>& needle)
+	{
+		const auto result = std::search(haystack.begin(), haystack.end(), needle.begin(), needle.end());
+		return result != haystack.end() || needle.empty() ? static_cast<std::size_t>(result - haystack.begin()) : lingo::utility::not_found;
+	}
+
+	template <typename Item>
+	std::size_t reference_search_reverse(const std::vector<Item>& haystack, const std::vector<Item>& needle)
+	{
+		const auto result = std::find_end(haystack.begin(), haystack.end(), needle.begin(), needle.end());
+		if (needle.empty())
+		{
+			return haystack.size();
+		}
+		return result != haystack.end() ? static_cast<std::size_t>(result - haystack.begin()) : lingo::utility::not_found;
+	}
+
+	template <typename Item>
+	void test_search(const std::vector<Item>& haystack, const std::vector<Item>& needle)
+	{
+		REQUIRE(lingo::utility::search_items(haystack.data(), haystack.size(), needle.data(), needle.size()) == reference_search(haystack, needle));
+		REQUIRE(lingo::utility::search_items_reverse(haystack.data(), haystack.size(), needle.data(), needle.size()) == reference_search_reverse(haystack, needle));
+	}
+
+	template <typename Item>
+	void test_random_search(std::size_t alphabet_size)
+	{
+		std::mt19937 random(static_cast<std::mt19937::result_type>(alphabet_size));
+		std::uniform_int_distribution<int> item_distribution(0, static_cast<int>(alphabet_size) - 1);
+
+		for (std::size_t iteration = 0; iteration < 200; ++iteration)
+		{
+			std::vector<Item> haystack(std::uniform_int_distribution<std::size_t>(0, 300)(random));
+			for (auto& item : haystack)
+			{
+				item = static_cast<Item>('a' + item_distribution(random));
+			}
+
+			const std::size_t needle_size = std::uniform_int_distribution<std::size_t>(0, 40)(random);
+
+			// A piece of the haystack, so there is at least one match
+			if (needle_size <= haystack.size())
+			{
+				const std::size_t offset = std::uniform_int_distribution<std::size_t>(0, haystack.size() - needle_size)(random);
+				test_search(haystack, std::vector<Item>(haystack.begin() + offset, haystack.begin() + offset + needle_size));
+			}
+
+			// A random needle, which most likely does not match
+			std::vector<Item> needle(needle_size);
+			for (auto& item : needle)
+			{
+				item = static_cast<Item>('a' + item_distribution(random));
+			}
+			test_search(haystack, needle);
+		}
+	}
+}
+
+TEST_CASE("search_items finds the same matches as std::search")
+{
+	test_random_search<char>(2);
+	test_random_search<char>(4);
+	test_random_search<char>(26);
+	test_random_search<char16_t>(2);
+	test_random_search<char32_t>(3);
+}
+
+TEST_CASE("search_items handles periodic needles")
+{
+	// Needles longer than the filter threshold with a short period use the periodic Two-Way variant
+	const std::vector<char> needle(32, 'a');
+	std::vector<char> haystack(100, 'a');
+	haystack[31] = 'b';
+	haystack[90] = 'b';
+	test_search(haystack, needle);
+
+	std::vector<char> periodic_needle;
+	for (int i = 0; i < 10; ++i)
+	{
+		periodic_needle.push_back('a');
+		periodic_needle.push_back('b');
+		periodic_needle.push_back('a');
+	}
+	std::vector<char> periodic_haystack = periodic_needle;
+	periodic_haystack.insert(periodic_haystack.begin() + 15, periodic_needle.begin(), periodic_needle.end());
+	test_search(periodic_haystack, periodic_needle);
+}
+
+TEST_CASE("search_items handles empty inputs")
+{
+	const std::vector<char> empty;
+	const std::vector<char> text = { 'a', 'b', 'c' };
+
+	test_search(empty, empty);
+	test_search(text, empty);
+	test_search(empty, text);
+	REQUIRE(lingo::utility::search_items_reverse(text.data(), text.size(), empty.data(), empty.size()) == 3);
+}
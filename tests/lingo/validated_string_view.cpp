@@ -0,0 +1,90 @@
+#include <catch/catch.hpp>
+
+#if LINGO_TEST_SPLIT
+#include <lingo/string.hpp>
+#include <lingo/validated_string_view.hpp>
+
+#include <lingo/encoding/utf8.hpp>
+#include <lingo/encoding/utf16.hpp>
+
+#include <lingo/page/unicode.hpp>
+#else
+#include <lingo/test/include_all.hpp>
+#endif
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace
+{
+	using utf8_encoding = lingo::encoding::utf8<char, char32_t>;
+	using utf16_encoding = lingo::encoding::utf16<char16_t, char32_t>;
+	using unicode_page = lingo::page::unicode_default;
+
+	using utf8_string_view = lingo::basic_string_view<utf8_encoding, unicode_page>;
+	using utf8_validated_string_view = lingo::basic_validated_string_view<utf8_encoding, unicode_page>;
+	using utf16_string = lingo::basic_string<utf16_encoding, unicode_page>;
+
+	// "aé\U0001F600"
+	const char valid_units[] = "a\xC3\xA9\xF0\x9F\x98\x80";
+	const char invalid_units[] = "a\xC3";
+}
+
+TEST_CASE("validated_string_view validates its input")
+{
+	REQUIRE(utf8_validated_string_view::validate(utf8_string_view(valid_units, sizeof(valid_units) - 1)) == lingo::error::error_code::success);
+	REQUIRE(utf8_validated_string_view::validate(utf8_string_view(invalid_units, sizeof(invalid_units) - 1)) == lingo::error::error_code::source_buffer_too_small);
+
+	REQUIRE_NOTHROW(utf8_validated_string_view(utf8_string_view(valid_units, sizeof(valid_units) - 1)));
+	REQUIRE_THROWS_AS(utf8_validated_string_view(utf8_string_view(invalid_units, sizeof(invalid_units) - 1)), lingo::error::exception);
+
+	const utf8_validated_string_view assumed(utf8_string_view(valid_units, sizeof(valid_units) - 1), lingo::assume_valid);
+	REQUIRE(assumed.data() == valid_units);
+	REQUIRE(assumed.size() == sizeof(valid_units) - 1);
+}
+
+TEST_CASE("validated_string_view can iterate over points")
+{
+	const utf8_validated_string_view view(utf8_string_view(valid_units, sizeof(valid_units) - 1));
+
+	std::vector<char32_t> points;
+	std::copy(view.point_begin(), view.point_end(), std::back_inserter(points));
+
+	REQUIRE(points == std::vector<char32_t>{ U'a', U'é', U'\U0001F600' });
+}
+
+TEST_CASE("validated_string_view can be compared")
+{
+	const char smaller_units[] = "a\xC3\xA9";
+
+	const utf8_validated_string_view view(utf8_string_view(valid_units, sizeof(valid_units) - 1));
+	const utf8_validated_string_view same(utf8_string_view(valid_units, sizeof(valid_units) - 1));
+	const utf8_validated_string_view smaller(utf8_string_view(smaller_units, sizeof(smaller_units) - 1));
+
+	REQUIRE(view.compare(same) == 0);
+	REQUIRE(view.compare(smaller) > 0);
+	REQUIRE(smaller.compare(view) < 0);
+
+	REQUIRE(view == same);
+	REQUIRE(view != smaller);
+	REQUIRE(smaller < view);
+	REQUIRE(view > smaller);
+	REQUIRE(smaller <= view);
+	REQUIRE(view >= same);
+
+	// Still comparable with regular string views
+	REQUIRE(view == utf8_string_view(valid_units, sizeof(valid_units) - 1));
+}
+
+TEST_CASE("validated_string_view can be converted")
+{
+	const utf8_validated_string_view view(utf8_string_view(valid_units, sizeof(valid_units) - 1));
+
+	const utf16_string string(view);
+
+	const char16_t expected[] = { u'a', u'é', 0xD83D, 0xDE00 };
+	REQUIRE(string.size() == 4);
+	REQUIRE(std::equal(expected, expected + 4, string.data()));
+	REQUIRE(string == utf16_string(utf8_string_view(valid_units, sizeof(valid_units) - 1)));
+}